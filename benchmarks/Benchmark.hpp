@@ -0,0 +1,168 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace benchmarks {
+
+/// Return the counter of the heap allocations made by the benchmark executable (incremented by its replacement of `operator new`).
+inline auto allocations() -> std::atomic<std::size_t>&
+{
+    static std::atomic<std::size_t> counter{0};
+    return counter;
+}
+
+/// The state of a benchmark run for a given size, which times the operation passed to @ref measure.
+class State
+{
+  public:
+    /// Construct a State object for a run with given size (e.g., number of rows) and minimum measurement time in seconds.
+    State(std::size_t size, double mintime) : m_size(size), m_mintime(mintime) {}
+
+    /// Return the size of the run (e.g., the number of rows of the data sets).
+    auto size() const -> std::size_t { return m_size; }
+
+    /// Set the number of bytes processed by each call to the measured operation (used to report throughputs).
+    auto bytes(std::size_t count) -> void { m_bytes = count; }
+
+    /// Call an operation repeatedly until the minimum measurement time is reached (at least once), timing it.
+    /// Preparation done before this call (e.g., filling vectors) is not part of the measurement.
+    template <typename Function>
+    auto measure(const Function& function) -> void
+    {
+        using clock = std::chrono::steady_clock;
+        const auto startallocations = benchmarks::allocations().load();
+        const auto start = clock::now();
+        double elapsed = 0.0;
+        do
+        {
+            function();
+            ++m_iterations;
+            elapsed = std::chrono::duration<double>(clock::now() - start).count();
+        } while(elapsed < m_mintime);
+        m_seconds = elapsed;
+        m_allocations = benchmarks::allocations().load() - startallocations;
+    }
+
+    /// Return the number of calls to the measured operation.
+    auto iterations() const -> std::size_t { return m_iterations; }
+
+    /// Return the total time of the calls to the measured operation in seconds.
+    auto seconds() const -> double { return m_seconds; }
+
+    /// Return the number of bytes processed by each call to the measured operation (0 if not set).
+    auto bytes() const -> std::size_t { return m_bytes; }
+
+    /// Return the total number of heap allocations made by the calls to the measured operation.
+    auto allocations() const -> std::size_t { return m_allocations; }
+
+  private:
+    std::size_t m_size = 0;        ///< The size of the run
+    double m_mintime = 0.0;        ///< The minimum measurement time in seconds
+    std::size_t m_iterations = 0;  ///< The number of calls to the measured operation
+    double m_seconds = 0.0;        ///< The total time of the calls to the measured operation in seconds
+    std::size_t m_bytes = 0;       ///< The number of bytes processed by each call to the measured operation
+    std::size_t m_allocations = 0; ///< The total number of heap allocations made by the calls to the measured operation
+};
+
+/// A registered benchmark, run for each power of ten from 1e2 up to its maximum size (once with size 1 if its maximum size is 1).
+struct Benchmark
+{
+    std::string name;                    ///< The name of the benchmark (e.g., "gnuplot::writedataset")
+    std::size_t maxsize = 1;             ///< The maximum size of the runs of the benchmark
+    std::function<void(State&)> run;     ///< The function preparing and measuring a run of the benchmark
+};
+
+/// Return the registered benchmarks.
+inline auto registry() -> std::vector<Benchmark>&
+{
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+/// Register a benchmark (see @ref SCIPLOT_BENCHMARK).
+inline auto registerbenchmark(std::string name, std::size_t maxsize, std::function<void(State&)> run) -> bool
+{
+    registry().push_back({ std::move(name), maxsize, std::move(run) });
+    return true;
+}
+
+/// A stream buffer that discards its output and counts its bytes, so that serialization is measured without any I/O.
+class NullBuffer : public std::streambuf
+{
+  public:
+    /// Return the number of bytes written to the buffer.
+    auto numbytes() const -> std::size_t { return m_numbytes; }
+
+  protected:
+    auto overflow(int_type ch) -> int_type override
+    {
+        ++m_numbytes;
+        return traits_type::not_eof(ch);
+    }
+
+    auto xsputn(const char*, std::streamsize count) -> std::streamsize override
+    {
+        m_numbytes += static_cast<std::size_t>(count);
+        return count;
+    }
+
+  private:
+    std::size_t m_numbytes = 0;  ///< The number of bytes written to the buffer
+};
+
+/// Prevent the compiler from optimizing away the computation of a value.
+template <typename T>
+auto donotoptimize(const T& value) -> void
+{
+#if defined(_MSC_VER)
+    static const void* volatile sink;
+    sink = &value;
+#else
+    asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+} // namespace benchmarks
+
+#define SCIPLOT_BENCHMARK_CONCAT_(a, b) a##b
+#define SCIPLOT_BENCHMARK_CONCAT(a, b) SCIPLOT_BENCHMARK_CONCAT_(a, b)
+
+/// Define a benchmark with given name and maximum size, whose body receives a `benchmarks::State& state`.
+#define SCIPLOT_BENCHMARK(name, maxsize)                                                                                              \
+    static void SCIPLOT_BENCHMARK_CONCAT(sciplotbenchmark, __LINE__)(benchmarks::State & state);                                        \
+    static const bool SCIPLOT_BENCHMARK_CONCAT(sciplotbenchmarkregistered, __LINE__) =                                                  \
+        benchmarks::registerbenchmark(name, maxsize, SCIPLOT_BENCHMARK_CONCAT(sciplotbenchmark, __LINE__));                           \
+    static void SCIPLOT_BENCHMARK_CONCAT(sciplotbenchmark, __LINE__)(benchmarks::State & state)
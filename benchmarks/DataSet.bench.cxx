@@ -0,0 +1,108 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <ostream>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/DataSet.hpp>
+#include <sciplot/Utils.hpp>
+
+// Benchmark includes
+#include <benchmarks/Benchmark.hpp>
+using namespace sciplot;
+
+namespace {
+
+/// Return a vector with given number of values that are not trivially formatted (e.g., 0.00123456, 1.00123456, ...).
+auto values(std::size_t size) -> std::vector<double>
+{
+    std::vector<double> v(size);
+    for(std::size_t i = 0; i < size; ++i)
+        v[i] = i + 0.00123456;
+    return v;
+}
+
+} // namespace
+
+SCIPLOT_BENCHMARK("internal::write", 100000000)
+{
+    const auto x = values(state.size());
+    const auto y = values(state.size());
+    benchmarks::NullBuffer buffer;
+    std::ostream out(&buffer);
+    state.measure([&] { internal::write(out, x, y); });
+    state.bytes(buffer.numbytes() / state.iterations());
+}
+
+SCIPLOT_BENCHMARK("internal::write (operator<< baseline)", 100000000)
+{
+    // The rows written with operator<< per value, as internal::write did before it appended them into a character buffer
+    const auto x = values(state.size());
+    const auto y = values(state.size());
+    benchmarks::NullBuffer buffer;
+    std::ostream out(&buffer);
+    state.measure([&] {
+        for(std::size_t i = 0; i < x.size(); ++i)
+            out << x[i] << ' ' << y[i] << '\n';
+    });
+    state.bytes(buffer.numbytes() / state.iterations());
+}
+
+SCIPLOT_BENCHMARK("internal::writebinary", 100000000)
+{
+    const auto x = values(state.size());
+    const auto y = values(state.size());
+    benchmarks::NullBuffer buffer;
+    std::ostream out(&buffer);
+    state.measure([&] { internal::writebinary(out, x, y); });
+    state.bytes(buffer.numbytes() / state.iterations());
+}
+
+SCIPLOT_BENCHMARK("gnuplot::writedataset", 100000000)
+{
+    const auto dataset = internal::makedataset(values(state.size()), values(state.size()));
+    benchmarks::NullBuffer buffer;
+    std::ostream out(&buffer);
+    state.measure([&] { gnuplot::writedataset(out, 0, *dataset); });
+    state.bytes(buffer.numbytes() / state.iterations());
+}
+
+SCIPLOT_BENCHMARK("gnuplot::writebinarydataset", 100000000)
+{
+    const auto dataset = internal::makedataset(values(state.size()), values(state.size()));
+    benchmarks::NullBuffer buffer;
+    std::ostream out(&buffer);
+    state.measure([&] { gnuplot::writebinarydataset(out, *dataset); });
+    state.bytes(buffer.numbytes() / state.iterations());
+}
+
+SCIPLOT_BENCHMARK("DataSet::hash", 100000000)
+{
+    const auto dataset = internal::makedataset(values(state.size()), values(state.size()));
+    state.measure([&] { benchmarks::donotoptimize(dataset->hash()); });
+    state.bytes(state.size() * dataset->recordsize());
+}
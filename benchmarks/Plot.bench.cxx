@@ -0,0 +1,89 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Figure.hpp>
+#include <sciplot/Plot.hpp>
+
+// Benchmark includes
+#include <benchmarks/Benchmark.hpp>
+using namespace sciplot;
+
+SCIPLOT_BENCHMARK("Plot::Plot", 1)
+{
+    state.measure([&] { Plot plot; benchmarks::donotoptimize(plot); });
+}
+
+SCIPLOT_BENCHMARK("Plot::drawCurve", 100000000)
+{
+    const std::vector<double> x(state.size(), 1.0);
+    const std::vector<double> y(state.size(), 2.0);
+    state.measure([&] {
+        Plot plot;
+        plot.drawCurve(x, y);
+        benchmarks::donotoptimize(plot);
+    });
+    state.bytes(2 * state.size() * sizeof(double));
+}
+
+SCIPLOT_BENCHMARK("Plot::repr", 10000) // the size is the number of curves
+{
+    Plot plot;
+    for(std::size_t i = 0; i < state.size(); ++i)
+        plot.drawCurve(std::vector<double>{ 0, 1 }, std::vector<double>{ 1, 0 }).label("curve");
+    state.measure([&] { benchmarks::donotoptimize(plot.repr()); });
+}
+
+SCIPLOT_BENCHMARK("Plot::repr (changed setup)", 10000) // the size is the number of curves; the labels, tics, grid, border and legend are changed before each call
+{
+    Plot plot;
+    for(std::size_t i = 0; i < state.size(); ++i)
+        plot.drawCurve(std::vector<double>{ 0, 1 }, std::vector<double>{ 1, 0 }).label("curve");
+    state.measure([&] {
+        plot.xlabel("x");
+        plot.ylabel("y");
+        plot.xtics().fontSize(10);
+        plot.ytics().fontSize(10);
+        plot.grid().show();
+        plot.border().lineWidth(2);
+        plot.legend().atTopLeft();
+        benchmarks::donotoptimize(plot.repr());
+    });
+}
+
+SCIPLOT_BENCHMARK("Figure::Figure", 1000) // the size is the number of plots
+{
+    std::vector<std::vector<Plot>> plots(state.size() / 10, std::vector<Plot>(10));
+    for(auto& row : plots)
+        for(auto& plot : row)
+            plot.drawCurve(std::vector<double>{ 0, 1 }, std::vector<double>{ 1, 0 });
+    state.measure([&] {
+        Figure figure(plots);
+        benchmarks::donotoptimize(figure);
+    });
+}
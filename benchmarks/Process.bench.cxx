@@ -0,0 +1,47 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <cstdlib>
+
+// sciplot includes
+#include <sciplot/Process.hpp>
+
+// Benchmark includes
+#include <benchmarks/Benchmark.hpp>
+using namespace sciplot;
+
+// The renders of plots and figures start gnuplot once per save, which is compared here using a program that exits immediately.
+// The difference between both benchmarks is the latency saved per render by spawning gnuplot without a shell.
+
+SCIPLOT_BENCHMARK("std::system", 1)
+{
+    state.measure([&] { benchmarks::donotoptimize(std::system("true")); });
+}
+
+SCIPLOT_BENCHMARK("internal::runprocess", 1)
+{
+    state.measure([&] { benchmarks::donotoptimize(internal::runprocess({ "true" })); });
+}
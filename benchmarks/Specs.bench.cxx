@@ -0,0 +1,68 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// sciplot includes
+#include <sciplot/specs/AxisLabelSpecs.hpp>
+#include <sciplot/specs/DrawSpecs.hpp>
+#include <sciplot/specs/GridSpecs.hpp>
+#include <sciplot/specs/LegendSpecs.hpp>
+#include <sciplot/specs/TicsSpecsMajor.hpp>
+
+// Benchmark includes
+#include <benchmarks/Benchmark.hpp>
+using namespace sciplot;
+
+SCIPLOT_BENCHMARK("DrawSpecs::repr", 1)
+{
+    DrawSpecs specs("'plot0.dat' index 0", "1:2", "lines");
+    specs.label("curve").lineColor("red").lineWidth(2);
+    state.measure([&] { benchmarks::donotoptimize(specs.repr()); });
+}
+
+SCIPLOT_BENCHMARK("AxisLabelSpecs::repr", 1)
+{
+    AxisLabelSpecs specs("x");
+    specs.text("Time [s]");
+    state.measure([&] { benchmarks::donotoptimize(specs.repr()); });
+}
+
+SCIPLOT_BENCHMARK("TicsSpecsMajor::repr", 1)
+{
+    TicsSpecsMajor specs("x");
+    state.measure([&] { benchmarks::donotoptimize(specs.repr()); });
+}
+
+SCIPLOT_BENCHMARK("GridSpecs::repr", 1)
+{
+    GridSpecs specs;
+    state.measure([&] { benchmarks::donotoptimize(specs.repr()); });
+}
+
+SCIPLOT_BENCHMARK("LegendSpecs::repr", 1)
+{
+    LegendSpecs specs;
+    specs.atTopLeft();
+    state.measure([&] { benchmarks::donotoptimize(specs.repr()); });
+}
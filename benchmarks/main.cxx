@@ -0,0 +1,184 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+
+// Benchmark includes
+#include <benchmarks/Benchmark.hpp>
+
+/// Replace the global allocation functions to count the heap allocations of the measured operations (the array forms call these).
+auto operator new(std::size_t size) -> void*
+{
+    benchmarks::allocations().fetch_add(1, std::memory_order_relaxed);
+    if(auto ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+auto operator delete(void* ptr) noexcept -> void
+{
+    std::free(ptr);
+}
+
+auto operator delete(void* ptr, std::size_t) noexcept -> void
+{
+    std::free(ptr);
+}
+
+namespace {
+
+/// Return a string escaped as a JSON string literal.
+auto jsonstr(const std::string& str) -> std::string
+{
+    std::string escaped = "\"";
+    for(const auto ch : str)
+    {
+        if(ch == '"' || ch == '\\') escaped += '\\';
+        escaped += ch;
+    }
+    return escaped + "\"";
+}
+
+/// Print the usage of the benchmark executable.
+auto usage() -> void
+{
+    std::cerr << "Usage: sciplot-benchmarks [options]\n"
+                 "  --filter <text>    Run only the benchmarks whose name contains the given text\n"
+                 "  --max-size <n>     Limit the size of the runs (default: 1e8)\n"
+                 "  --min-time <s>     Set the minimum measurement time of each run in seconds (default: 0.2)\n"
+                 "  --output <file>    Write the JSON results to a file instead of the standard output\n"
+                 "  --list             List the benchmarks and exit\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::string filter;
+    std::string output;
+    std::size_t maxsize = 100000000;
+    double mintime = 0.2;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const auto hasvalue = i + 1 < argc;
+        if(arg == "--filter" && hasvalue) filter = argv[++i];
+        else if(arg == "--max-size" && hasvalue) maxsize = static_cast<std::size_t>(std::atof(argv[++i]));
+        else if(arg == "--min-time" && hasvalue) mintime = std::atof(argv[++i]);
+        else if(arg == "--output" && hasvalue) output = argv[++i];
+        else if(arg == "--list")
+        {
+            for(const auto& benchmark : benchmarks::registry())
+                std::cout << benchmark.name << std::endl;
+            return EXIT_SUCCESS;
+        }
+        else
+        {
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Keep the temporary files of the benchmarks out of the working directory
+    sciplot::scratchDirectory(std::filesystem::temp_directory_path().string());
+
+    std::ofstream file;
+    if(!output.empty())
+        file.open(output);
+    std::ostream& json = output.empty() ? std::cout : file;
+
+    char date[32];
+    const auto now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    json << "{\n";
+    json << "  \"context\": {\n";
+    json << "    \"date\": " << jsonstr(date) << ",\n";
+#if defined(__VERSION__)
+    json << "    \"compiler\": " << jsonstr(__VERSION__) << ",\n";
+#endif
+#if defined(NDEBUG)
+    json << "    \"assertions\": false,\n";
+#else
+    json << "    \"assertions\": true,\n";
+#endif
+    json << "    \"hardware_concurrency\": " << std::thread::hardware_concurrency() << ",\n";
+    json << "    \"min_time\": " << mintime << "\n";
+    json << "  },\n";
+    json << "  \"benchmarks\": [";
+
+    auto first = true;
+    for(const auto& benchmark : benchmarks::registry())
+    {
+        if(benchmark.name.find(filter) == std::string::npos)
+            continue;
+
+        for(std::size_t size = benchmark.maxsize == 1 ? 1 : 100; size <= std::min(benchmark.maxsize, maxsize); size *= 10)
+        {
+            std::cerr << benchmark.name << " [" << size << "] ... " << std::flush;
+            benchmarks::State state(size, mintime);
+            benchmark.run(state);
+
+            const auto seconds = state.seconds() / state.iterations();
+            std::cerr << seconds * 1e6 << " us" << std::endl;
+
+            json << (first ? "\n" : ",\n");
+            json << "    {\n";
+            json << "      \"name\": " << jsonstr(benchmark.name) << ",\n";
+            json << "      \"size\": " << size << ",\n";
+            json << "      \"iterations\": " << state.iterations() << ",\n";
+            json << "      \"seconds_per_iteration\": " << seconds << ",\n";
+            json << "      \"allocations_per_iteration\": " << static_cast<double>(state.allocations()) / state.iterations();
+            if(state.bytes() > 0)
+            {
+                json << ",\n      \"bytes_per_iteration\": " << state.bytes();
+                json << ",\n      \"bytes_per_second\": " << state.bytes() / seconds;
+            }
+            json << "\n    }";
+            first = false;
+
+            if(size == 1)
+                break;
+        }
+    }
+
+    json << "\n  ]\n";
+    json << "}\n";
+
+    return EXIT_SUCCESS;
+}
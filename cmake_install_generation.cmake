@@ -6,6 +6,15 @@ add_library(sciplot INTERFACE)
 # Set sciplot compilation features to be propagated to client code.
 target_compile_features(sciplot INTERFACE cxx_std_17)
 
+# Link sciplot dependencies (threads are used to process large data sets in parallel)
+find_package(Threads REQUIRED)
+target_link_libraries(sciplot INTERFACE Threads::Threads)
+
+# Link the std::filesystem library (used by the render cache), which is separate in GCC 8
+if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU" AND CMAKE_CXX_COMPILER_VERSION VERSION_LESS 9.0)
+    target_link_libraries(sciplot INTERFACE stdc++fs)
+endif()
+
 target_include_directories(sciplot INTERFACE
         $<BUILD_INTERFACE:${PROJECT_SOURCE_DIR}>
         $<INSTALL_INTERFACE:${CMAKE_INSTALL_INCLUDEDIR}>
@@ -0,0 +1,294 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Utils.hpp>
+#include <sciplot/Vec.hpp>
+
+namespace sciplot {
+namespace internal {
+
+/// The base class of the data sets of a plot, whose vectors are only serialized when the plot data is saved.
+class DataSet
+{
+  public:
+    /// Pure virtual destructor (this class is an abstract base class).
+    virtual ~DataSet() = default;
+
+    /// Return the number of rows in the data set (i.e., the size of its smallest vector).
+    virtual auto size() const -> std::size_t = 0;
+
+    /// Return the gnuplot binary format of the records in the data set (e.g., "%double%double").
+    virtual auto binaryformat() const -> std::string = 0;
+
+    /// Return the number of bytes of each binary record in the data set.
+    virtual auto recordsize() const -> std::size_t = 0;
+
+    /// Write the rows of the data set as lines of text into an ostream object.
+    virtual auto write(std::ostream& out) const -> std::ostream& = 0;
+
+    /// Write the rows of the data set as raw binary records into an ostream object (only numeric data sets).
+    virtual auto writebinary(std::ostream& out) const -> std::ostream& = 0;
+
+    /// Return a hash of the contents of the data set (of its binary records if it is numeric, of its text otherwise).
+    virtual auto hash() const -> std::uint64_t = 0;
+
+    /// Return the number of columns (i.e., vectors) in the data set.
+    virtual auto numcolumns() const -> std::size_t = 0;
+
+    /// Return true if all columns of the data set are numeric.
+    virtual auto numeric() const -> bool = 0;
+
+    /// Return a hash of the first @ref size values of a column of the data set.
+    virtual auto columnhash(std::size_t column) const -> std::uint64_t = 0;
+
+    /// Append the text of the value at given row and column of the data set to a character buffer.
+    virtual auto appendvalue(std::string& buffer, std::size_t row, std::size_t column) const -> void = 0;
+
+    /// Return a copy of the data set owning all its vectors if it has views of vectors (see @ref VecView), or nullptr otherwise.
+    virtual auto ownedcopy() const -> std::shared_ptr<const DataSet> = 0;
+};
+
+/// Check if type @p V is a VecView type.
+template <typename V>
+constexpr auto isVecView = false;
+
+/// Check if type @p V is a VecView type.
+template <typename V>
+constexpr auto isVecView<VecView<V>> = true;
+
+/// Return a copy of the entries of a vector (or a view of a vector) in a std::vector object.
+template <typename V>
+auto copyvec(const V& vec)
+{
+    std::vector<std::decay_t<decltype(vec[0])>> copy;
+    copy.reserve(vec.size());
+    for(std::size_t i = 0; i < vec.size(); ++i)
+        copy.push_back(vec[i]);
+    return copy;
+}
+
+/// The data set of a plot with vectors of given types (either owned vectors or views of vectors).
+template <typename... Vecs>
+class DataSetOf : public DataSet
+{
+  public:
+    /// Construct a DataSetOf object with given vectors.
+    DataSetOf(Vecs... vecs) : m_vecs(std::move(vecs)...) {}
+
+    auto size() const -> std::size_t override
+    {
+        return std::apply([](const auto&... vecs) { return minsize(vecs...); }, m_vecs);
+    }
+
+    auto binaryformat() const -> std::string override
+    {
+        return (internal::binaryformat<Vecs>() + ...);
+    }
+
+    auto recordsize() const -> std::size_t override
+    {
+        return ((internal::binaryformat<Vecs>() == "%float" ? sizeof(float) : sizeof(double)) + ...);
+    }
+
+    auto write(std::ostream& out) const -> std::ostream& override
+    {
+        return std::apply([&](const auto&... vecs) -> std::ostream& { return internal::write(out, vecs...); }, m_vecs);
+    }
+
+    auto writebinary(std::ostream& out) const -> std::ostream& override
+    {
+        if constexpr((isNumberVector<Vecs> && ...))
+            return std::apply([&](const auto&... vecs) -> std::ostream& { return internal::writebinary(out, vecs...); }, m_vecs);
+        else throw std::runtime_error("Cannot write a data set with non-numeric vectors in binary format.");
+    }
+
+    auto hash() const -> std::uint64_t override
+    {
+        HashBuffer buffer;
+        std::ostream out(&buffer);
+        if constexpr((isNumberVector<Vecs> && ...))
+            writebinary(out);
+        else write(out);
+        return hashcombine(buffer.hash(), fnv1a(binaryformat())); // the format distinguishes data sets with the same values in a different number of columns
+    }
+
+    auto numcolumns() const -> std::size_t override
+    {
+        return sizeof...(Vecs);
+    }
+
+    auto numeric() const -> bool override
+    {
+        return (isNumberVector<Vecs> && ...);
+    }
+
+    auto columnhash(std::size_t column) const -> std::uint64_t override
+    {
+        auto hash = FNV1A_OFFSET_BASIS;
+        visitcolumn(column, [&](const auto& vec) {
+            using V = std::decay_t<decltype(vec)>;
+            const auto numrows = size();
+            std::string buffer;
+            for(std::size_t i = 0; i < numrows; ++i)
+            {
+                if constexpr(isNumberVector<V>)
+                    appendbinaryvalue(buffer, vec[i]);
+                else appendline(buffer, i, vec);
+                if(buffer.size() >= DEFAULT_DATA_BUFFER_SIZE)
+                {
+                    hash = fnv1a(buffer, hash);
+                    buffer.clear();
+                }
+            }
+            hash = hashcombine(fnv1a(buffer, hash), fnv1a(internal::binaryformat<V>()));
+        });
+        return hash;
+    }
+
+    auto appendvalue(std::string& buffer, std::size_t row, std::size_t column) const -> void override
+    {
+        visitcolumn(column, [&](const auto& vec) { internal::appendvalue(buffer, vec[row]); });
+    }
+
+    auto ownedcopy() const -> std::shared_ptr<const DataSet> override
+    {
+        if constexpr((isVecView<Vecs> || ...))
+            return std::apply([](const auto&... vecs) -> std::shared_ptr<const DataSet> {
+                return std::make_shared<DataSetOf<decltype(copyvec(vecs))...>>(copyvec(vecs)...);
+            }, m_vecs);
+        else return nullptr;
+    }
+
+  private:
+    /// Call a function with the vector at given column of the data set.
+    template <typename Function>
+    auto visitcolumn(std::size_t column, const Function& function) const -> void
+    {
+        std::size_t i = 0;
+        std::apply([&](const auto&... vecs) { ((i++ == column ? function(vecs) : void()), ...); }, m_vecs);
+    }
+
+    /// The vectors (or views of vectors) in the data set.
+    std::tuple<Vecs...> m_vecs;
+};
+
+/// Return a view as is, or a copy of the entries of any other vector, so that it can be stored in a data set.
+template <typename V>
+auto datasetvec(const V& vec)
+{
+    if constexpr(isVecView<V>)
+        return vec;
+    else return copyvec(vec);
+}
+
+/// Return a new data set with given vectors. Views (see @ref view) are stored as is, other vectors are copied.
+template <typename... Args>
+auto makedataset(const Args&... args) -> std::shared_ptr<const DataSet>
+{
+    return std::make_shared<DataSetOf<decltype(datasetvec(args))...>>(datasetvec(args)...);
+}
+
+/// Return the number of values in given data sets, which measures the work of serializing or hashing them (see @ref parallelfor).
+inline auto numvalues(const std::vector<std::shared_ptr<const DataSet>>& datasets) -> std::size_t
+{
+    std::size_t count = 0;
+    for(const auto& dataset : datasets)
+        count += dataset->size() * dataset->numcolumns();
+    return count;
+}
+
+} // namespace internal
+
+namespace gnuplot {
+
+/// Auxiliary function to create a data set in an ostream object that is understood by gnuplot
+inline auto writedataset(std::ostream& out, std::size_t index, const internal::DataSet& dataset) -> std::ostream&
+{
+    // Save the rows of the data set in a new data set of the data file
+    out << "#==============================================================================" << std::endl;
+    out << "# DATASET #" << index << std::endl;
+    out << "#==============================================================================" << std::endl;
+
+    // Write the rows of the data set to the ostream object
+    dataset.write(out);
+
+    // Ensure two blank lines are added here so that gnuplot understands a new data set has been added
+    out << "\n\n";
+
+    return out;
+}
+
+/// Auxiliary function to create a data set in an ostream object with given columns of data sets (all with the same number of rows)
+inline auto writedataset(std::ostream& out, std::size_t index, const std::vector<std::pair<const internal::DataSet*, std::size_t>>& columns) -> std::ostream&
+{
+    out << "#==============================================================================" << std::endl;
+    out << "# DATASET #" << index << std::endl;
+    out << "#==============================================================================" << std::endl;
+
+    // Write the rows with the values of the given columns
+    const auto numrows = columns.empty() ? 0 : columns.front().first->size();
+    internal::writerows(out, numrows, [&](std::string& buffer, std::size_t i) {
+        for(std::size_t j = 0; j < columns.size(); ++j)
+        {
+            columns[j].first->appendvalue(buffer, i, columns[j].second);
+            buffer += j + 1 < columns.size() ? ' ' : '\n';
+        }
+    });
+
+    // Ensure two blank lines are added here so that gnuplot understands a new data set has been added
+    out << "\n\n";
+
+    return out;
+}
+
+/// Auxiliary function to create a named datablock (e.g., `$DATA_0`) with a data set in a gnuplot script
+inline auto writedatablock(std::ostream& out, const std::string& name, const internal::DataSet& dataset) -> std::ostream&
+{
+    out << name << " << EOD\n";
+    dataset.write(out);
+    out << "EOD\n";
+    return out;
+}
+
+/// Auxiliary function to create a binary data set in an ostream object (raw little-endian records without any header)
+inline auto writebinarydataset(std::ostream& out, const internal::DataSet& dataset) -> std::ostream&
+{
+    return dataset.writebinary(out);
+}
+
+} // namespace gnuplot
+} // namespace sciplot
@@ -25,6 +25,9 @@
 
 #pragma once
 
+// C++ includes
+#include <cstddef>
+
 // sciplot includes
 #include <sciplot/Constants.hpp>
 #include <sciplot/Enums.hpp>
@@ -73,5 +76,7 @@ const auto DEFAULT_TICS_SCALE_MAJOR_BY = 0.50;
 const auto DEFAULT_TICS_SCALE_MINOR_BY = 0.25;
 const auto DEFAULT_TICS_MINOR_SHOW = false;
 
+const auto DEFAULT_DATA_BUFFER_SIZE = std::size_t(1) << 16; // the number of bytes of formatted data to buffer before writing them out
+
 } // namespace internal
 } // namespace sciplot
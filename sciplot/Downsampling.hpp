@@ -0,0 +1,217 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Utils.hpp>
+
+namespace sciplot {
+namespace internal {
+
+/// Return the indices of the points selected by the Largest-Triangle-Three-Buckets (LTTB) algorithm to represent a curve.
+/// The points of the curve, with @p x values sorted in increasing order, are split into `npoints - 2` buckets, and the point
+/// in each bucket forming the largest triangle with the previously selected point and the average point of the next bucket
+/// is selected. The first and last points are always kept. All indices are returned if the curve has at most @p npoints points.
+/// @see Sveinn Steinarsson, Downsampling Time Series for Visual Representation, MSc thesis, University of Iceland, 2013.
+template <typename X, typename Y>
+auto lttb(const X& x, const Y& y, std::size_t npoints) -> std::vector<std::size_t>
+{
+    const auto size = minsize(x, y);
+
+    std::vector<std::size_t> indices;
+
+    if(npoints >= size || npoints < 3)
+    {
+        indices.resize(size);
+        for(std::size_t i = 0; i < size; ++i)
+            indices[i] = i;
+        return indices;
+    }
+
+    indices.reserve(npoints);
+
+    // The number of points in each bucket (the first and last points are buckets of their own)
+    const auto every = static_cast<double>(size - 2) / (npoints - 2);
+
+    // The index of the previously selected point
+    std::size_t a = 0;
+    indices.push_back(a);
+
+    for(std::size_t i = 0; i < npoints - 2; ++i)
+    {
+        // The average point of the next bucket
+        const auto nextbegin = static_cast<std::size_t>(std::floor((i + 1) * every)) + 1;
+        const auto nextend = std::min(static_cast<std::size_t>(std::floor((i + 2) * every)) + 1, size);
+        double avgx = 0.0;
+        double avgy = 0.0;
+        for(auto j = nextbegin; j < nextend; ++j)
+        {
+            avgx += x[j];
+            avgy += y[j];
+        }
+        avgx /= nextend - nextbegin;
+        avgy /= nextend - nextbegin;
+
+        // The point of the current bucket forming the largest triangle with the previous point and the average point
+        const auto begin = static_cast<std::size_t>(std::floor(i * every)) + 1;
+        const auto end = static_cast<std::size_t>(std::floor((i + 1) * every)) + 1;
+        const double ax = x[a];
+        const double ay = y[a];
+        auto maxarea = -1.0;
+        for(auto j = begin; j < end; ++j)
+        {
+            const auto area = std::abs((ax - avgx) * (y[j] - ay) - (ax - x[j]) * (avgy - ay));
+            if(area > maxarea)
+            {
+                maxarea = area;
+                a = j;
+            }
+        }
+
+        indices.push_back(a);
+    }
+
+    indices.push_back(size - 1);
+
+    return indices;
+}
+
+/// The minimum number of points of a curve for its M4 aggregation to be split among threads.
+constexpr std::size_t M4_PARALLEL_MIN_SIZE = std::size_t(1) << 20;
+
+/// Return the indices of the points selected by the M4 aggregation to represent a curve on a canvas with given width in pixels.
+/// The points of the curve, with @p x values sorted in increasing order, are split into @p width buckets of equal *x* length
+/// (one per pixel column), and the first, minimum, maximum and last points of each bucket are selected. The rasterized line
+/// through these points is identical to the one through all points, while their number is bounded by `4 * width`.
+/// All indices are returned if the curve has at most `4 * width` points. Buckets are aggregated in parallel for large curves.
+/// @param numthreads The number of threads used to aggregate the buckets (0 to decide automatically based on the curve size)
+/// @see Uwe Jugel et al., M4: A Visualization-Oriented Time Series Data Aggregation, Proc. VLDB Endowment 7(10), 2014.
+template <typename X, typename Y>
+auto m4(const X& x, const Y& y, std::size_t width, std::size_t numthreads = 0) -> std::vector<std::size_t>
+{
+    const auto size = minsize(x, y);
+
+    std::vector<std::size_t> indices;
+
+    if(width == 0 || size <= 4 * width)
+    {
+        indices.resize(size);
+        for(std::size_t i = 0; i < size; ++i)
+            indices[i] = i;
+        return indices;
+    }
+
+    // The index of the first point in each bucket (the boundaries of the pixel columns found with binary search)
+    const double xmin = x[0];
+    const double xmax = x[size - 1];
+    std::vector<std::size_t> begins(width + 1, size);
+    begins[0] = 0;
+    for(std::size_t b = 1; b < width; ++b)
+    {
+        const auto xb = xmin + (xmax - xmin) * b / width;
+        auto lo = begins[b - 1];
+        auto hi = size;
+        while(lo < hi)
+        {
+            const auto mid = lo + (hi - lo) / 2;
+            if(x[mid] < xb) lo = mid + 1;
+            else hi = mid;
+        }
+        begins[b] = lo;
+    }
+
+    // The first, minimum, maximum and last points of each bucket (in this order of index), or `size` in empty buckets
+    std::vector<std::size_t> selected(4 * width, size);
+
+    const auto aggregate = [&](std::size_t bfirst, std::size_t blast)
+    {
+        for(auto b = bfirst; b < blast; ++b)
+        {
+            const auto begin = begins[b];
+            const auto end = begins[b + 1];
+            if(begin == end)
+                continue;
+            auto imin = begin;
+            auto imax = begin;
+            double ymin = y[begin];
+            double ymax = y[begin];
+            for(auto j = begin + 1; j < end; ++j)
+            {
+                const double yj = y[j];
+                imin = yj < ymin ? j : imin;
+                ymin = yj < ymin ? yj : ymin;
+                imax = yj > ymax ? j : imax;
+                ymax = yj > ymax ? yj : ymax;
+            }
+            selected[4 * b + 0] = begin;
+            selected[4 * b + 1] = std::min(imin, imax);
+            selected[4 * b + 2] = std::max(imin, imax);
+            selected[4 * b + 3] = end - 1;
+        }
+    };
+
+    // Aggregate blocks of contiguous buckets in parallel, if the curve is large enough
+    if(numthreads == 0)
+        numthreads = size < M4_PARALLEL_MIN_SIZE ? 1 : parallelthreads();
+    numthreads = std::min(numthreads, width);
+
+    std::vector<std::thread> threads;
+    const auto blocksize = (width + numthreads - 1) / numthreads;
+    for(std::size_t t = 1; t < numthreads; ++t)
+        threads.emplace_back(aggregate, std::min(t * blocksize, width), std::min((t + 1) * blocksize, width));
+    aggregate(0, std::min(blocksize, width));
+    for(auto& thread : threads)
+        thread.join();
+
+    // Collect the selected indices, which are already sorted, skipping empty buckets and repeated points
+    indices.reserve(selected.size());
+    for(auto i : selected)
+        if(i != size && (indices.empty() || indices.back() != i))
+            indices.push_back(i);
+
+    return indices;
+}
+
+/// Return a vector with the entries of a given vector at given indices.
+template <typename V>
+auto gather(const V& v, const std::vector<std::size_t>& indices)
+{
+    std::vector<std::decay_t<decltype(v[0])>> result;
+    result.reserve(indices.size());
+    for(auto i : indices)
+        result.push_back(v[i]);
+    return result;
+}
+
+} // namespace internal
+} // namespace sciplot
@@ -26,6 +26,13 @@
 #pragma once
 
 // C++ includes
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <initializer_list>
+#include <map>
+#include <sstream>
+#include <utility>
 #include <vector>
 
 // sciplot includes
@@ -63,11 +70,19 @@ class Figure
     /// Set the title of the figure.
     auto title(const std::string& title) -> Figure&;
 
+    /// Toggle shared data mode (disabled by default).
+    /// In shared data mode, the data sets saved as text by all plots are written once to a single data file of the figure,
+    /// in which identical data sets are saved only once, and numeric data sets with the same number of rows drawn with
+    /// the default columns share a single data set with their distinct columns (e.g., a common x vector is saved only once).
+    /// The draw commands of the plots are rewritten to reference this file. Binary and inline data sets are saved as usual.
+    auto sharedData(bool enable = true) -> void;
+
     /// Write the current plot data of all plots to the data file(s).
     auto saveplotdata() const -> void;
 
     /// Show the figure in a pop-up window.
     /// @note This method removes temporary files after saving if `Figure::autoclean(true)` (default).
+    /// @throws RenderTimeout if gnuplot exceeded the timeout set with @ref renderLimits.
     auto show() const -> void;
 
     /// Save the figure in a file, with its extension defining the file format.
@@ -75,14 +90,102 @@ class Figure
     /// The supported formats are: `pdf`, `eps`, `svg`, `png`, and `jpeg`.
     /// Thus, to save the figure in `pdf` format, choose a file name as in `fig.pdf`.
     /// @note This method removes temporary files after saving if `Figure::autoclean(true)` (default).
-    auto save(const std::string& filename) const -> void;
+    /// @return True if gnuplot saved the figure successfully.
+    /// @throws RenderTimeout if gnuplot exceeded the timeout set with @ref renderLimits.
+    auto save(const std::string& filename) const -> bool;
+
+    /// Save the figure in several files (e.g., `figure.save({"figure.png", "figure.pdf", "figure.svg"})`), with their extensions defining their formats.
+    /// The data is written once, and a single gnuplot process renders all the files, switching its terminal and output for each one.
+    /// Files already in the render cache (see @ref renderCache) are restored from it, and only the others are rendered.
+    /// @note This method removes temporary files after saving if `Figure::autoclean(true)` (default).
+    /// @return True if gnuplot saved the figure successfully in all files.
+    /// @throws RenderTimeout if gnuplot exceeded the timeout set with @ref renderLimits.
+    auto save(const std::vector<std::string>& filenames) const -> bool;
+
+    /// Save the figure in several files listed in braces (see the overload taking a vector of file names).
+    auto save(std::initializer_list<std::string> filenames) const -> bool;
+
+    /// Save the figure in a file using a gnuplot process that is kept alive between saves (see @ref GnuplotSession).
+    /// The script is sent to the session instead of being written to the script file, avoiding one gnuplot process per save.
+    /// @note This method removes temporary files after saving if `Figure::autoclean(true)` (default).
+    /// @return True if gnuplot saved the figure successfully.
+    /// @throws RenderTimeout if gnuplot exceeded the timeout set with @ref renderLimits.
+    auto save(const std::string& filename, GnuplotSession& session) const -> bool;
+
+    /// Render the figure in given format (e.g., "png", "svg" or "pdf") and return the bytes of the image, without writing any output file.
+    /// gnuplot writes the image to its standard output, which is read through a pipe. An empty vector is returned if gnuplot failed.
+    /// @note This method removes temporary files after rendering if `Figure::autoclean(true)` (default).
+    /// @note In-memory rendering is only supported on POSIX systems.
+    /// @throws RenderTimeout if gnuplot exceeded the timeout set with @ref renderLimits.
+    auto render(const std::string& format) const -> std::vector<std::byte>;
+
+    /// Render the figure in given format (e.g., "png", "svg" or "pdf") and write the bytes of the image to an output stream as gnuplot
+    /// produces them (e.g., to stream the image in an HTTP response), without writing any output file.
+    /// @note This method removes temporary files after rendering if `Figure::autoclean(true)` (default).
+    /// @note In-memory rendering is only supported on POSIX systems.
+    /// @return True if gnuplot rendered the figure successfully.
+    /// @throws RenderTimeout if gnuplot exceeded the timeout set with @ref renderLimits.
+    auto render(const std::string& format, std::ostream& out) const -> bool;
+
+    /// Save the figure in a file in a background thread, returning immediately with the future result of @ref save.
+    /// The figure and its plots are copied first as in @ref Plot::saveAsync, so they can be changed or destroyed right away,
+    /// and the figure can be saved again before the returned future is ready.
+    /// @note As with any future returned by `std::async`, destroying the returned future waits for the save to complete.
+    auto saveAsync(const std::string& filename) const -> std::future<bool>;
+
+    /// Set the render cache used by @ref save to restore the figure instead of running gnuplot, if it was already saved
+    /// with the same terminal settings, scripts and data (see @ref RenderCache). Pass nullptr to disable caching (the default).
+    auto renderCache(std::shared_ptr<RenderCache> cache) -> void;
+
+    /// Set a function called with the wall time and byte counts of the phases of every call to @ref save, @ref show, @ref render
+    /// and @ref saveplotdata (see @ref RenderStats). Pass nullptr to disable it (the default). The callbacks of the plots are not called.
+    /// @note The function is called by the thread that saves the figure (e.g., a background thread for @ref saveAsync).
+    auto renderCallback(RenderCallback callback) -> void;
+
+    /// Set the wall time, CPU time and memory limits of the gnuplot processes run by @ref save and @ref show (see @ref RenderLimits).
+    /// A render exceeding its timeout is killed and throws @ref RenderTimeout, after its files are removed and its stats are reported.
+    auto renderLimits(RenderLimits limits) -> void;
 
     /// Delete all files used to store plot data or scripts.
     auto cleanup() const -> void;
 
   private:
+    friend class RenderPool;
+
+    /// Return a copy of the figure to be rendered in the background (see @ref saveAsync), with a new id and snapshots of its plots (see @ref Plot::snapshot).
+    auto snapshot() const -> Figure;
+
+    /// The data sets in the shared data file of the figure and the draw specs of the plots referencing them (see @ref sharedData).
+    struct SharedData
+    {
+        std::vector<std::vector<std::pair<const internal::DataSet*, std::size_t>>> blocks; ///< The data set and column index of each column of each data set in the shared data file
+        std::vector<std::vector<DrawSpecs>> drawspecs; ///< The draw specs of each plot in layout order (empty if shared data mode is disabled)
+    };
+
+    /// Return the data sets in the shared data file and the rewritten draw specs of the plots (none if shared data mode is disabled).
+    auto shareddata() const -> SharedData;
+
+    /// Write the current plot data of all plots to the data file(s), using the given shared data file layout, and return the number of bytes written.
+    auto saveplotdata(const SharedData& shared) const -> std::size_t;
+
+    /// Return the steps of a render of the figure shared by all operations (see @ref internal::render): deduplicating the data sets
+    /// into @p shared, writing the data files, using the render cache, removing the temporary files if autoclean is enabled,
+    /// and reporting to the render callback.
+    auto rendersteps(std::string operation, SharedData& shared) const -> internal::RenderSteps;
+
+    /// Write the gnuplot commands that render the figure in given format (e.g., "pdf") to an output file (or to the standard output of gnuplot
+    /// if the file name is empty) into an ostream object, with given plot commands (see @ref plotcmds).
+    auto savescript(std::ostream& script, const std::string& format, const std::string& output, const std::string& plotcmds) const -> void;
+
+    /// Return the plot commands of all plots in the figure, in layout order, referencing the given shared data file layout.
+    auto plotcmds(const SharedData& shared) const -> std::string;
+
+    /// Return the key of the figure saved in a file with given name in the render cache.
+    auto rendercachekey(const std::string& filename) const -> std::uint64_t;
+
     /// Counter of how many plot / singleplot objects have been instanciated in the application
-    static std::size_t m_counter;
+    /// Atomic, so that figures can be constructed concurrently
+    static std::atomic<std::size_t> m_counter;
 
     /// Plot id derived from m_counter upon construction
     /// Must be the first member due to constructor initialization order!
@@ -91,6 +194,9 @@ class Figure
     /// Toggle automatic cleaning of temporary files (enabled by default)
     bool m_autoclean = true;
 
+    /// Toggle shared data mode (disabled by default)
+    bool m_shareddata = false;
+
     /// The name of the gnuplot palette to be used
     std::string m_palette;
 
@@ -115,16 +221,29 @@ class Figure
     /// The name of the file where the plot commands are saved
     std::string m_scriptfilename;
 
+    /// The name of the file where the data sets of all plots are saved in shared data mode
+    std::string m_datafilename;
+
     /// All the plots that have been added to the figure
     std::vector<std::vector<Plot>> m_plots;
+
+    /// The render cache used to skip gnuplot when the figure was already saved (if any)
+    std::shared_ptr<RenderCache> m_rendercache;
+
+    /// The function called with the stats of every render (if any)
+    RenderCallback m_rendercallback;
+
+    /// The limits of the gnuplot processes rendering the figure
+    RenderLimits m_renderlimits;
 };
 
 // Initialize the counter of plot objects
-inline std::size_t Figure::m_counter = 0;
+inline std::atomic<std::size_t> Figure::m_counter{0};
 
 inline Figure::Figure(const std::initializer_list<std::initializer_list<Plot>>& plots)
 : m_id(m_counter++),
-  m_scriptfilename("multishow" + internal::str(m_id) + ".plt")
+  m_scriptfilename(internal::scratchfilename("multishow", m_id, ".plt")),
+  m_datafilename(internal::scratchfilename("figure", m_id, ".dat"))
 {
     m_layoutrows = plots.size();
     m_layoutcols = 1;
@@ -137,7 +256,8 @@ inline Figure::Figure(const std::initializer_list<std::initializer_list<Plot>>&
 
 inline Figure::Figure(const std::vector<std::vector<Plot>>& plots)
 : m_id(m_counter++),
-  m_scriptfilename("multishow" + internal::str(m_id) + ".plt"),
+  m_scriptfilename(internal::scratchfilename("multishow", m_id, ".plt")),
+  m_datafilename(internal::scratchfilename("figure", m_id, ".dat")),
   m_plots(plots)
 {
     m_layoutrows = plots.size();
@@ -146,6 +266,23 @@ inline Figure::Figure(const std::vector<std::vector<Plot>>& plots)
         m_layoutcols = std::max(m_layoutcols, row.size()); // m_layoutcols = max number of columns among all rows
 }
 
+inline auto Figure::snapshot() const -> Figure
+{
+    Figure figure = *this;
+    figure.m_id = m_counter++;
+    figure.m_scriptfilename = internal::scratchfilename("multishow", figure.m_id, ".plt");
+    figure.m_datafilename = internal::scratchfilename("figure", figure.m_id, ".dat");
+    std::vector<std::vector<Plot>> plots;
+    for(const auto& row : m_plots)
+    {
+        plots.emplace_back();
+        for(const auto& plot : row)
+            plots.back().push_back(plot.snapshot());
+    }
+    figure.m_plots = std::move(plots);
+    return figure;
+}
+
 inline auto Figure::autoclean(bool enable) -> void
 {
     m_autoclean = enable;
@@ -180,62 +317,268 @@ inline auto Figure::title(const std::string& title) -> Figure&
     return *this;
 }
 
+inline auto Figure::sharedData(bool enable) -> void
+{
+    m_shareddata = enable;
+}
+
 inline auto Figure::saveplotdata() const -> void
 {
-    for(const auto& row : m_plots)
-        for(const auto& plot : row)
-            plot.savePlotData();
+    internal::Stopwatch stopwatch;
+    RenderStats stats;
+    stats.operation = "saveplotdata";
+    stats.databytes = saveplotdata(shareddata());
+    stats.datatime = stopwatch.lap();
+    stats.success = true;
+    internal::reportstats(stats, stopwatch, m_rendercallback);
 }
 
-inline auto Figure::show() const -> void
+inline auto Figure::saveplotdata(const SharedData& shared) const -> std::size_t
 {
-    // Open script file and truncate it
-    std::ofstream script(m_scriptfilename);
+    internal::TraceScope trace("Figure::saveplotdata");
+    // Collect the plots writing their own data files, skipping copies of the same plot (which use the same files) in the figure
+    std::vector<const Plot*> plots;
+    for(const auto& row : m_plots)
+        for(const auto& plot : row)
+            if(std::none_of(plots.begin(), plots.end(), [&](const Plot* other) { return other->m_datafilename == plot.m_datafilename; }))
+                plots.push_back(&plot);
 
-    // Add palette info. Use default palette if the user hasn't set one
-    gnuplot::palettecmd(script, m_palette.empty() ? internal::DEFAULT_PALETTE : m_palette);
+    // Serialize the data sets of the plots in parallel (if there are enough of them), each plot to its own files
+    std::size_t textvalues = 0;
+    std::size_t binaryvalues = 0;
+    for(const auto* plot : plots)
+    {
+        textvalues += internal::numvalues(plot->m_datasets);
+        binaryvalues += internal::numvalues(plot->m_bindatasets);
+    }
+    std::atomic<std::size_t> numbytes{0};
+    if(!m_shareddata)
+    {
+        internal::parallelfor(plots.size(), textvalues + binaryvalues, [&](std::size_t i) { numbytes += plots[i]->writeplotdata(); });
+        return numbytes;
+    }
 
-    // Add terminal info
-    auto width = m_width == 0 ? internal::DEFAULT_FIGURE_WIDTH : m_width;
-    auto height = m_height == 0 ? internal::DEFAULT_FIGURE_HEIGHT : m_height;
-    std::string size = gnuplot::sizestr(width, height, false);
-    gnuplot::showterminalcmd(script, size, m_font);
+    // Open the shared data file, truncate it and write the deduplicated data sets of all plots to it
+    if(!shared.blocks.empty())
+    {
+        std::ofstream data(m_datafilename);
+        for(std::size_t i = 0; i < shared.blocks.size(); ++i)
+            gnuplot::writedataset(data, i, shared.blocks[i]);
+        numbytes += data ? static_cast<std::size_t>(data.tellp()) : 0;
+    }
 
-    // Add multiplot commands
-    gnuplot::multiplotcmd(script, m_layoutrows, m_layoutcols, m_title);
+    // The binary data sets are still saved by each plot
+    internal::parallelfor(plots.size(), binaryvalues, [&](std::size_t i) { numbytes += plots[i]->savebinaryplotdata(); });
+    return numbytes;
+}
 
-    // Add the plot commands
+inline auto Figure::shareddata() const -> SharedData
+{
+    internal::TraceScope trace("Figure::shareddata");
+    SharedData shared;
+    if(!m_shareddata)
+        return shared;
+
+    // The data sets drawn by the plots, whose columns are merged (if numeric and drawn with the default columns) or which are saved whole
+    struct Draw
+    {
+        const internal::DataSet* dataset = nullptr;
+        bool merged = false;
+        std::vector<std::uint64_t> hashes; ///< The hash of each column if merged, of the whole data set otherwise
+    };
+
+    std::vector<Draw> draws;
+    std::size_t numvalues = 0;
     for(const auto& row : m_plots)
         for(const auto& plot : row)
-            script << plot.repr();
+            for(std::size_t i = 0; i < plot.m_drawspecs.size(); ++i)
+                if(plot.m_drawdatasets[i] != std::string::npos)
+                {
+                    const auto& dataset = *plot.m_datasets[plot.m_drawdatasets[i]];
+                    draws.push_back({ &dataset, dataset.numeric() && plot.m_drawspecs[i].use().empty(), {} });
+                    numvalues += dataset.size() * dataset.numcolumns();
+                }
+
+    // Hash the data sets in parallel (if there are enough of them), which reads all their data
+    internal::parallelfor(draws.size(), numvalues, [&](std::size_t k) {
+        auto& draw = draws[k];
+        if(!draw.merged)
+            draw.hashes = { draw.dataset->hash() };
+        else for(std::size_t j = 0; j < draw.dataset->numcolumns(); ++j)
+            draw.hashes.push_back(draw.dataset->columnhash(j));
+    });
+
+    // The data set in the shared data file with the whole contents of each data set hash
+    std::map<std::uint64_t, std::size_t> datasetblocks;
+
+    // The data set in the shared data file with the columns of numeric data sets with a given number of rows,
+    // and the column number (starting at 1) in it of each column hash
+    std::map<std::size_t, std::pair<std::size_t, std::map<std::uint64_t, std::size_t>>> columnblocks;
+
+    std::size_t k = 0;
+    for(const auto& row : m_plots)
+    {
+        for(const auto& plot : row)
+        {
+            auto drawspecs = plot.m_drawspecs;
+            for(std::size_t i = 0; i < drawspecs.size(); ++i)
+            {
+                if(plot.m_drawdatasets[i] == std::string::npos)
+                    continue;
+                const auto& draw = draws[k++];
+                const auto& dataset = *draw.dataset;
+
+                // Merge the distinct columns of numeric data sets drawn with the default columns, which can be drawn with explicit ones instead
+                if(draw.merged)
+                {
+                    auto [it, inserted] = columnblocks.try_emplace(dataset.size());
+                    auto& [block, columns] = it->second;
+                    if(inserted)
+                    {
+                        block = shared.blocks.size();
+                        shared.blocks.emplace_back();
+                    }
+                    std::string use;
+                    for(std::size_t j = 0; j < dataset.numcolumns(); ++j)
+                    {
+                        const auto [column, added] = columns.try_emplace(draw.hashes[j], shared.blocks[block].size() + 1);
+                        if(added)
+                            shared.blocks[block].emplace_back(&dataset, j);
+                        use += (j == 0 ? "" : ":") + internal::str(column->second);
+                    }
+                    drawspecs[i].what("'" + m_datafilename + "' index " + internal::str(block)).use(use);
+                    continue;
+                }
+
+                // Otherwise, save identical data sets only once, keeping their `using` expressions
+                const auto [it, inserted] = datasetblocks.try_emplace(draw.hashes.front(), shared.blocks.size());
+                if(inserted)
+                {
+                    shared.blocks.emplace_back();
+                    for(std::size_t j = 0; j < dataset.numcolumns(); ++j)
+                        shared.blocks.back().emplace_back(&dataset, j);
+                }
+                drawspecs[i].what("'" + m_datafilename + "' index " + internal::str(it->second));
+            }
+            shared.drawspecs.push_back(std::move(drawspecs));
+        }
+    }
+    return shared;
+}
 
-    // Add an empty line at the end and close the script to avoid crashes with gnuplot
-    script << std::endl;
-    script.close();
+inline auto Figure::show() const -> void
+{
+    internal::TraceScope trace("Figure::show");
+    SharedData shared;
+    auto steps = rendersteps("show", shared);
+    steps.writescript = [&](const std::vector<std::string>&) {
+        // Open script file and truncate it
+        std::ofstream script(m_scriptfilename);
+
+        // Add palette info. Use default palette if the user hasn't set one
+        gnuplot::palettecmd(script, m_palette.empty() ? internal::DEFAULT_PALETTE : m_palette);
+
+        // Add terminal info
+        auto width = m_width == 0 ? internal::DEFAULT_FIGURE_WIDTH : m_width;
+        auto height = m_height == 0 ? internal::DEFAULT_FIGURE_HEIGHT : m_height;
+        std::string size = gnuplot::sizestr(width, height, false);
+        gnuplot::showterminalcmd(script, size, m_font);
+
+        // Add multiplot commands
+        gnuplot::multiplotcmd(script, m_layoutrows, m_layoutcols, m_title);
+
+        // Add the plot commands
+        script << plotcmds(shared);
+
+        // Add an empty line at the end to avoid crashes with gnuplot
+        script << std::endl;
+        return script ? static_cast<std::size_t>(script.tellp()) : 0;
+    };
+    steps.rungnuplot = [&] { return gnuplot::runscript(m_scriptfilename, true, m_renderlimits); };
+    internal::render(steps);
+}
 
-    // save plot data to file(s)
-    saveplotdata();
+inline auto Figure::save(const std::string& filename) const -> bool
+{
+    return save(std::vector<std::string>{ filename });
+}
 
-    // Show the figure
-    gnuplot::runscript(m_scriptfilename, true);
+inline auto Figure::save(std::initializer_list<std::string> filenames) const -> bool
+{
+    return save(std::vector<std::string>(filenames));
+}
 
-    // remove the temporary files if user wants to
-    if(m_autoclean)
-    {
-        cleanup();
-    }
+inline auto Figure::save(const std::vector<std::string>& filenames) const -> bool
+{
+    internal::TraceScope trace("Figure::save");
+    SharedData shared;
+    auto steps = rendersteps("save", shared);
+    steps.filenames = filenames;
+    steps.writescript = [&](const std::vector<std::string>& pending) {
+        // Open script file and write the commands that save the figure into it, repeating the multiplot for each other file
+        // (replot only redraws the last plot of a multiplot)
+        const auto cmds = plotcmds(shared);
+        std::ofstream script(m_scriptfilename);
+        for(const auto& filename : pending)
+            savescript(script, gnuplot::fileformat(filename), filename, cmds);
+        return script ? static_cast<std::size_t>(script.tellp()) : 0;
+    };
+    steps.rungnuplot = [&] { return gnuplot::runscript(m_scriptfilename, false, m_renderlimits); };
+    return internal::render(steps);
 }
 
-inline auto Figure::save(const std::string& filename) const -> void
+inline auto Figure::save(const std::string& filename, GnuplotSession& session) const -> bool
 {
-    // Clean the file name to prevent errors
-    auto cleanedfilename = gnuplot::cleanpath(filename);
+    internal::TraceScope trace("Figure::save");
+    SharedData shared;
+    std::string commands;
+    auto steps = rendersteps("save", shared);
+    steps.filenames = { filename };
+    steps.writescript = [&](const std::vector<std::string>&) {
+        // Write the commands that save the figure into a string, which is sent to gnuplot instead of a script file
+        std::ostringstream script;
+        savescript(script, gnuplot::fileformat(filename), filename, plotcmds(shared));
+        commands = script.str();
+        return commands.size();
+    };
+    steps.rungnuplot = [&] { return internal::runsession(session, commands, m_renderlimits); };
+    return internal::render(steps);
+}
 
-    // Get extension from file name
-    auto extension = cleanedfilename.substr(cleanedfilename.rfind(".") + 1);
+inline auto Figure::render(const std::string& format) const -> std::vector<std::byte>
+{
+    std::vector<std::byte> bytes;
+    internal::ByteVectorBuffer buffer(bytes);
+    std::ostream out(&buffer);
+    if(!render(format, out))
+        bytes.clear();
+    return bytes;
+}
+
+inline auto Figure::render(const std::string& format, std::ostream& out) const -> bool
+{
+    internal::TraceScope trace("Figure::render");
+    SharedData shared;
+    auto steps = rendersteps("render", shared);
+    steps.writescript = [&](const std::vector<std::string>&) {
+        // Open script file and write the commands that render the figure to the standard output of gnuplot into it
+        std::ofstream script(m_scriptfilename);
+        savescript(script, format, "", plotcmds(shared));
+        return script ? static_cast<std::size_t>(script.tellp()) : 0;
+    };
+    steps.rungnuplot = [&] { return gnuplot::runscript(m_scriptfilename, out, m_renderlimits); };
+    return internal::render(steps);
+}
+
+inline auto Figure::saveAsync(const std::string& filename) const -> std::future<bool>
+{
+    return std::async(std::launch::async, [figure = snapshot(), filename] { return figure.save(filename); });
+}
 
-    // Open script file
-    std::ofstream script(m_scriptfilename);
+inline auto Figure::savescript(std::ostream& script, const std::string& format, const std::string& output, const std::string& plotcmds) const -> void
+{
+    // Clean the file name to prevent errors
+    auto cleanedfilename = gnuplot::cleanpath(output);
 
     // Add palette info. Use default palette if the user hasn't set one
     gnuplot::palettecmd(script, m_palette.empty() ? internal::DEFAULT_PALETTE : m_palette);
@@ -243,8 +586,8 @@ inline auto Figure::save(const std::string& filename) const -> void
     // Add terminal info
     auto width = m_width == 0 ? internal::DEFAULT_FIGURE_WIDTH : m_width;
     auto height = m_height == 0 ? internal::DEFAULT_FIGURE_HEIGHT : m_height;
-    std::string size = gnuplot::sizestr(width, height, extension == "pdf");
-    gnuplot::saveterminalcmd(script, extension, size, m_font);
+    std::string size = gnuplot::sizestr(width, height, format == "pdf");
+    gnuplot::saveterminalcmd(script, format, size, m_font);
 
     // Add output command
     gnuplot::outputcmd(script, cleanedfilename);
@@ -253,9 +596,7 @@ inline auto Figure::save(const std::string& filename) const -> void
     gnuplot::multiplotcmd(script, m_layoutrows, m_layoutcols, m_title);
 
     // Add the plot commands
-    for(const auto& row : m_plots)
-        for(const auto& plot : row)
-            script << plot.repr();
+    script << plotcmds;
 
     // Close multiplot
     script << "unset multiplot" << std::endl;
@@ -264,26 +605,86 @@ inline auto Figure::save(const std::string& filename) const -> void
     script << std::endl;
     script << "set output";
 
-    // Add an empty line at the end and close the script to avoid crashes with gnuplot
+    // Add an empty line at the end to avoid crashes with gnuplot
     script << std::endl;
-    script.close();
-
-    // save plot data to file(s)
-    saveplotdata();
+}
 
-    // Save the figure as a file
-    gnuplot::runscript(m_scriptfilename, false);
+inline auto Figure::plotcmds(const SharedData& shared) const -> std::string
+{
+    std::vector<const Plot*> plots;
+    std::size_t numvalues = 0;
+    for(const auto& row : m_plots)
+        for(const auto& plot : row)
+        {
+            plots.push_back(&plot);
+            numvalues += internal::numvalues(plot.m_inlinedatasets);
+        }
+
+    // Generate the plot commands of the plots in parallel (if they embed enough inline data), and concatenate them in layout order
+    std::vector<std::string> reprs(plots.size());
+    internal::parallelfor(plots.size(), numvalues, [&](std::size_t k) {
+        reprs[k] = shared.drawspecs.empty() ? plots[k]->repr() : plots[k]->repr(shared.drawspecs[k]);
+    });
+
+    std::string cmds;
+    for(const auto& repr : reprs)
+        cmds += repr;
+    return cmds;
+}
 
-    // remove the temporary files if user wants to
-    if(m_autoclean)
+inline auto Figure::rendercachekey(const std::string& filename) const -> std::uint64_t
+{
+    // Hash the script without the plot commands (e.g., palette, terminal and layout), with a placeholder for the output file name
+    const auto cleanedfilename = gnuplot::cleanpath(filename);
+    const auto extension = gnuplot::fileformat(cleanedfilename);
+    std::ostringstream script;
+    savescript(script, extension, "output." + extension, "");
+
+    // Combine it with the hashes of the plot commands and data of all plots, in layout order
+    auto hash = internal::fnv1a(script.str());
+    for(const auto& row : m_plots)
     {
-        cleanup();
+        for(const auto& plot : row)
+            hash = internal::hashcombine(hash, plot.renderKey());
+        hash = internal::hashcombine(hash, row.size()); // distinguish layouts with the same plots in different rows
     }
+    return internal::hashcombine(hash, m_shareddata);
+}
+
+inline auto Figure::renderCache(std::shared_ptr<RenderCache> cache) -> void
+{
+    m_rendercache = std::move(cache);
+}
+
+inline auto Figure::renderCallback(RenderCallback callback) -> void
+{
+    m_rendercallback = std::move(callback);
+}
+
+inline auto Figure::renderLimits(RenderLimits limits) -> void
+{
+    m_renderlimits = limits;
+}
+
+inline auto Figure::rendersteps(std::string operation, SharedData& shared) const -> internal::RenderSteps
+{
+    internal::RenderSteps steps;
+    steps.operation = std::move(operation);
+    steps.cache = m_rendercache.get();
+    steps.cachekey = [this](const std::string& filename) { return rendercachekey(filename); };
+    steps.preparedata = [this, &shared] { shared = shareddata(); }; // deduplicate the data sets of the plots in shared data mode
+    steps.writedata = [this, &shared] { return saveplotdata(shared); };
+    if(m_autoclean)
+        steps.cleanup = [this] { cleanup(); };
+    steps.callback = m_rendercallback;
+    return steps;
 }
 
 inline auto Figure::cleanup() const -> void
 {
+    internal::TraceScope trace("Figure::cleanup");
     std::remove(m_scriptfilename.c_str());
+    std::remove(m_datafilename.c_str());
     for(const auto& row : m_plots)
         for(const auto& plot : row)
             plot.cleanup();
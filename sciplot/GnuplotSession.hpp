@@ -0,0 +1,151 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// sciplot includes
+#include <sciplot/Process.hpp>
+#include <sciplot/RenderLimits.hpp>
+#include <sciplot/Utils.hpp>
+
+namespace sciplot {
+
+/// A gnuplot process kept alive between renders, so that many plots and figures can be saved without starting a new process for each one.
+/// Pass it to @ref Plot::save or @ref Figure::save (e.g., `GnuplotSession session; plot.save("plot.pdf", session);`).
+/// The scripts are sent to gnuplot through a pipe, and each render waits for gnuplot to acknowledge its completion.
+/// The gnuplot process is started on first use, and started again if it has exited (e.g., after an error in a script).
+/// @note A session renders one script at a time and must not be shared between threads without synchronization.
+/// @note Sessions need gnuplot 5.2 or newer and are only supported on POSIX systems (all renders fail on Windows).
+class GnuplotSession
+{
+  public:
+    /// Construct a GnuplotSession object that runs the given gnuplot executable (searched in PATH).
+    explicit GnuplotSession(std::string program = "gnuplot");
+
+    /// Run a gnuplot script in the session and wait for it to complete.
+    /// The gnuplot state left by previous scripts is reset first, and gnuplot messages are forwarded to the standard error.
+    /// If the script does not complete within the given timeout in seconds (0 for no limit), the gnuplot process is killed
+    /// (a new one is started by the next call) and @ref timedout returns true.
+    /// Return false if gnuplot could not be started, exited, reported an error or exceeded the timeout while running the script.
+    auto run(const std::string& script, double timeout = 0.0) -> bool;
+
+    /// Return true if the gnuplot process of the session is currently alive.
+    auto running() const -> bool { return m_process.running(); }
+
+    /// Return true if the last script run by the session was killed after exceeding its timeout.
+    auto timedout() const -> bool { return m_timedout; }
+
+    /// Return true if the gnuplot process of the last script run by the session could be started (e.g., false if gnuplot is not in PATH).
+    auto started() const -> bool { return m_started; }
+
+    /// Terminate the gnuplot process of the session (a new one is started by the next call to @ref run).
+    auto close() -> void;
+
+  private:
+    std::string m_program;        ///< The gnuplot executable run by the session
+    internal::Process m_process;  ///< The gnuplot process, reading scripts from its standard input and acknowledging them on its standard error
+    std::size_t m_numscripts = 0; ///< The number of scripts sent to gnuplot, used to build unique acknowledgement tokens
+    bool m_timedout = false;      ///< True if the last script run by the session exceeded its timeout
+    bool m_started = false;       ///< True if the gnuplot process of the last script run by the session could be started
+};
+
+inline GnuplotSession::GnuplotSession(std::string program)
+: m_program(std::move(program))
+{
+}
+
+inline auto GnuplotSession::run(const std::string& script, double timeout) -> bool
+{
+    internal::TraceScope trace("GnuplotSession::run");
+    const auto deadline = internal::deadlineafter(timeout);
+    m_timedout = false;
+
+    // Start gnuplot if this is the first script, or if the previous gnuplot process has exited
+    m_started = m_process.running() || m_process.start({m_program}, internal::PipeInput | internal::PipeError);
+    if(!m_started)
+        return false;
+
+    // Reset the state left by previous scripts, run the script, and print a unique token followed by the error code of gnuplot.
+    // The token is printed on the standard error, which is unbuffered, so that it is received as soon as the script completes
+    // (the print target is reset first, since the script may have redirected it to a file with `set print`).
+    const auto token = "sciplot-session-done-" + internal::str(++m_numscripts);
+    std::string commands;
+    commands += "reset session\n";
+    commands += "reset errors\n";
+    commands += script;
+    commands += "\nset print\n";
+    commands += "print \"" + token + "\", GPVAL_ERRNO\n";
+
+    // Send the script, which fails if gnuplot exits before reading all of it (its messages are still forwarded below)
+    m_process.write(commands, deadline);
+
+    // Forward gnuplot messages until the token is received (or gnuplot exits, as it does on errors in scripts read from a pipe)
+    std::string line;
+    while(m_process.readline(internal::PipeError, line, deadline))
+    {
+        if(line.compare(0, token.size() + 1, token + " ") == 0)
+            return std::atoi(line.c_str() + token.size()) == 0;
+        std::cerr << line << std::endl;
+    }
+
+    // Kill gnuplot if it is still reading or running the script after the deadline
+    if(std::chrono::steady_clock::now() >= deadline)
+    {
+        m_process.kill();
+        m_timedout = true;
+    }
+
+    close();
+    return false;
+}
+
+inline auto GnuplotSession::close() -> void
+{
+    m_process.wait();
+}
+
+namespace internal {
+
+/// Run a script in a gnuplot session within the timeout of given limits (the other limits do not apply to sessions),
+/// and return its result like @ref runprocess (with exit code 1 if the script failed).
+inline auto runsession(GnuplotSession& session, const std::string& script, const RenderLimits& limits) -> ProcessResult
+{
+    ProcessResult result;
+    result.status = session.run(script, limits.timeout) ? 0 : 1;
+    result.started = session.started();
+    result.limitsfailed = limits.cputime > 0 || limits.memory > 0;
+    result.timedout = session.timedout();
+    return result;
+}
+
+} // namespace internal
+
+} // namespace sciplot
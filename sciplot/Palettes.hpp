@@ -26,13 +26,24 @@
 #pragma once
 
 // C++ includes
-#include <map>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 namespace sciplot {
 
+/// A gnuplot color palette.
+struct Palette
+{
+    std::string_view name;      ///< The name of the palette (e.g., "viridis")
+    std::string_view commands;  ///< The gnuplot commands defining the line styles and the colors of the palette
+};
+
 /// Gnuplot color palettes for sciplot adapted from https://github.com/Gnuplotting/gnuplot-palettes
-const std::map<std::string, std::string> palettes = {
+/// The palettes are sorted by name. The table is a constant without any dynamic initialization, shared by all translation units.
+inline constexpr Palette palettes[] = {
     { "accent", "# line styles for ColorBrewer Accent\n# for use with qualitative/categorical data\n# provides 8 colors, 4 pale and 4 saturated\n# compatible with gnuplot >=4.2\n# author: Anna Schneider\n\n# line styles\nset style line 1 lt 1 lc rgb '#7FC97F' # pale green\nset style line 2 lt 1 lc rgb '#BEAED4' # pale purple\nset style line 3 lt 1 lc rgb '#FDC086' # pale orange\nset style line 4 lt 1 lc rgb '#FFFF99' # pale yellow\nset style line 5 lt 1 lc rgb '#386CB0' # blue\nset style line 6 lt 1 lc rgb '#F0027F' # magenta\nset style line 7 lt 1 lc rgb '#BF5B17' # brown\nset style line 8 lt 1 lc rgb '#666666' # grey\n\n# palette\nset palette maxcolors 8\nset palette defined ( 0 '#7FC97F',\\\n    \t    \t      1 '#BEAED4',\\\n\t\t      2 '#FDC086',\\\n\t\t      3 '#FFFF99',\\\n\t\t      4 '#386CB0',\\\n\t\t      5 '#F0027F',\\\n\t\t      6 '#BF5B17',\\\n\t\t      7 '#666666' )\n" },
     { "blues", "# line styles for ColorBrewer Blues\n# for use with sequential data\n# provides 8 blue colors of increasing saturation\n# compatible with gnuplot >=4.2\n# author: Anna Schneider\n\n# line styles\nset style line 1 lt 1 lc rgb '#F7FBFF' # very light blue\nset style line 2 lt 1 lc rgb '#DEEBF7' # \nset style line 3 lt 1 lc rgb '#C6DBEF' # \nset style line 4 lt 1 lc rgb '#9ECAE1' # light blue\nset style line 5 lt 1 lc rgb '#6BAED6' # \nset style line 6 lt 1 lc rgb '#4292C6' # medium blue\nset style line 7 lt 1 lc rgb '#2171B5' #\nset style line 8 lt 1 lc rgb '#084594' # dark blue\n\n# palette\nset palette defined ( 0 '#F7FBFF',\\\n    \t    \t      1 '#DEEBF7',\\\n\t\t      2 '#C6DBEF',\\\n\t\t      3 '#9ECAE1',\\\n\t\t      4 '#6BAED6',\\\n\t\t      5 '#4292C6',\\\n\t\t      6 '#2171B5',\\\n\t\t      7 '#084594' )\n" },
     { "brbg", "# line styles for ColorBrewer BrBG\n# for use with divering data\n# provides 8 colors with brown low, white middle, and blue-green high\n# compatible with gnuplot >=4.2\n# author: Anna Schneider\n\n# line styles\nset style line 1 lt 1 lc rgb '#8C510A' # dark brown\nset style line 2 lt 1 lc rgb '#BF812D' # medium brown\nset style line 3 lt 1 lc rgb '#DFC27D' # \nset style line 4 lt 1 lc rgb '#F6E8C3' # pale brown\nset style line 5 lt 1 lc rgb '#C7EAE5' # pale blue-green\nset style line 6 lt 1 lc rgb '#80CDC1' # \nset style line 7 lt 1 lc rgb '#35978F' # medium blue-green\nset style line 8 lt 1 lc rgb '#01665E' # dark blue-green\n\n# palette\nset palette defined ( 0 '#8C510A',\\\n    \t    \t      1 '#BF812D',\\\n\t\t      2 '#DFC27D',\\\n\t\t      3 '#F6E8C3',\\\n\t\t      4 '#C7EAE5',\\\n\t\t      5 '#80CDC1',\\\n\t\t      6 '#35978F',\\\n\t\t      7 '#01665E' )\n" },
@@ -83,5 +94,30 @@ const std::map<std::string, std::string> palettes = {
     { "ylrd", "# line styles\nset style line 1 lt 1 lc rgb '#ffee00' # yellow \nset style line 2 lt 1 lc rgb '#ff7000' #\nset style line 3 lt 1 lc rgb '#ee0000' #\nset style line 4 lt 1 lc rgb '#7f0000' # red\n\n# palette\nset palette defined ( \\\n    0 '#ffee00', \\\n    1 '#ff7000', \\\n    2 '#ee0000', \\\n    3 '#7f0000')\n" },
 };
 
-} // namespace sciplot
+namespace internal {
+
+/// Return true if the palettes are sorted by name (with unique names), as required by @ref palettecommands.
+constexpr auto sortedpalettes() -> bool
+{
+    for(std::size_t i = 1; i < std::size(palettes); ++i)
+        if(!(palettes[i - 1].name < palettes[i].name))
+            return false;
+    return true;
+}
 
+static_assert(sortedpalettes(), "The palettes must be sorted by name.");
+
+} // namespace internal
+
+/// Return the gnuplot commands of the palette with given name, found by binary search in @ref palettes.
+/// @throws std::out_of_range if there is no palette with the given name.
+inline auto palettecommands(std::string_view name) -> std::string_view
+{
+    const auto it = std::lower_bound(std::begin(palettes), std::end(palettes), name,
+        [](const Palette& palette, std::string_view name) { return palette.name < name; });
+    if(it == std::end(palettes) || it->name != name)
+        throw std::out_of_range("There is no palette with name '" + std::string(name) + "'.");
+    return it->commands;
+}
+
+} // namespace sciplot
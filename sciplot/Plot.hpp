@@ -26,14 +26,26 @@
 #pragma once
 
 // C++ includes
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <initializer_list>
+#include <memory>
 #include <sstream>
 #include <vector>
 
 // sciplot includes
 #include <sciplot/Constants.hpp>
+#include <sciplot/DataSet.hpp>
 #include <sciplot/Default.hpp>
+#include <sciplot/Downsampling.hpp>
 #include <sciplot/Enums.hpp>
+#include <sciplot/GnuplotSession.hpp>
 #include <sciplot/Palettes.hpp>
+#include <sciplot/RenderCache.hpp>
+#include <sciplot/RenderLimits.hpp>
+#include <sciplot/RenderStats.hpp>
+#include <sciplot/RenderSteps.hpp>
 #include <sciplot/StringOrDouble.hpp>
 #include <sciplot/specs/AxisLabelSpecs.hpp>
 #include <sciplot/specs/BorderSpecs.hpp>
@@ -172,10 +184,12 @@ class Plot
     auto draw(std::string what, std::string use, std::string with) -> DrawSpecs&;
 
     /// Draw plot object with given style and given vectors (e.g., `plot.draw("lines", x, y)`).
+    /// The vectors are copied, unless they are given as views (e.g., `plot.drawWithVecs("lines", view(x), view(y))`),
+    /// in which case their data is only read when the plot data is saved (see @ref VecView).
     template <typename X, typename... Vecs>
     auto drawWithVecs(std::string with, const X&, const Vecs&... vecs) -> DrawSpecs&;
 
-    /// Draw a curve with given @p x and @p y vectors.
+    /// Draw a curve with given @p x and @p y vectors (downsampled if their size exceeds the one given in @ref downsample).
     template <typename X, typename Y>
     auto drawCurve(const X& x, const Y& y) -> DrawSpecs&;
 
@@ -381,11 +395,25 @@ class Plot
     /// Set the number of sample points for analytical plots.
     auto samples(std::size_t value) -> void;
 
+    /// Set the maximum number of points of the curves drawn with @ref drawCurve afterwards (0 disables downsampling, the default).
+    /// Curves with more points, whose *x* values must be sorted, are reduced with the Largest-Triangle-Three-Buckets algorithm,
+    /// which preserves their visual shape. A few thousand points are usually indistinguishable from the full curve.
+    /// @note The vectors of a downsampled curve are read when it is drawn, even if given as views.
+    auto downsample(std::size_t npoints) -> void;
+
+    /// Toggle pixel-aware min/max (M4) aggregation of the curves drawn with @ref drawCurve afterwards (disabled by default).
+    /// Curves, whose *x* values must be sorted, are split into one bucket per pixel column of the plot width (see @ref size),
+    /// and only the first, minimum, maximum and last points of each bucket are drawn. The resulting line is identical to the one
+    /// through all points, while the amount of data is bounded by the plot width. This takes precedence over @ref downsample.
+    /// @note The vectors of an aggregated curve are read when it is drawn, even if given as views. Call @ref size before drawing.
+    auto downsampleMinMax(bool enable = true) -> void;
+
     /// Use this method to provide gnuplot commands to be executed before the plotting calls.
     auto gnuplot(std::string command) -> void;
 
     /// Show the plot in a pop-up window.
     /// @note This method removes temporary files after saving if `Plot::autoclean(true)` (default).
+    /// @throws RenderTimeout if gnuplot exceeded the timeout set with @ref renderLimits.
     auto show() const -> void;
 
     /// Save the plot in a file, with its extension defining the file format.
@@ -393,19 +421,88 @@ class Plot
     /// The supported formats are: `pdf`, `eps`, `svg`, `png`, and `jpeg`.
     /// Thus, to save a plot in `pdf` format, choose a file as in `plot.pdf`.
     /// @note This method removes temporary files after saving if `Plot::autoclean(true)` (default).
-    auto save(std::string filename) const -> void;
+    /// @return True if gnuplot saved the plot successfully.
+    /// @throws RenderTimeout if gnuplot exceeded the timeout set with @ref renderLimits.
+    auto save(std::string filename) const -> bool;
+
+    /// Save the plot in several files (e.g., `plot.save({"plot.png", "plot.pdf", "plot.svg"})`), with their extensions defining their formats.
+    /// The data is written once, and a single gnuplot process renders all the files, switching its terminal and output for each one.
+    /// Files already in the render cache (see @ref renderCache) are restored from it, and only the others are rendered.
+    /// @note This method removes temporary files after saving if `Plot::autoclean(true)` (default).
+    /// @return True if gnuplot saved the plot successfully in all files.
+    /// @throws RenderTimeout if gnuplot exceeded the timeout set with @ref renderLimits.
+    auto save(const std::vector<std::string>& filenames) const -> bool;
+
+    /// Save the plot in several files listed in braces (see the overload taking a vector of file names).
+    auto save(std::initializer_list<std::string> filenames) const -> bool;
+
+    /// Save the plot in a file using a gnuplot process that is kept alive between saves (see @ref GnuplotSession).
+    /// The script is sent to the session instead of being written to the script file, avoiding one gnuplot process per save.
+    /// @note This method removes temporary files after saving if `Plot::autoclean(true)` (default).
+    /// @return True if gnuplot saved the plot successfully.
+    /// @throws RenderTimeout if gnuplot exceeded the timeout set with @ref renderLimits.
+    auto save(std::string filename, GnuplotSession& session) const -> bool;
+
+    /// Render the plot in given format (e.g., "png", "svg" or "pdf") and return the bytes of the image, without writing any output file.
+    /// gnuplot writes the image to its standard output, which is read through a pipe. An empty vector is returned if gnuplot failed.
+    /// @note This method removes temporary files after rendering if `Plot::autoclean(true)` (default).
+    /// @note In-memory rendering is only supported on POSIX systems.
+    /// @throws RenderTimeout if gnuplot exceeded the timeout set with @ref renderLimits.
+    auto render(const std::string& format) const -> std::vector<std::byte>;
+
+    /// Render the plot in given format (e.g., "png", "svg" or "pdf") and write the bytes of the image to an output stream as gnuplot
+    /// produces them (e.g., to stream the image in an HTTP response), without writing any output file.
+    /// @note This method removes temporary files after rendering if `Plot::autoclean(true)` (default).
+    /// @note In-memory rendering is only supported on POSIX systems.
+    /// @return True if gnuplot rendered the plot successfully.
+    /// @throws RenderTimeout if gnuplot exceeded the timeout set with @ref renderLimits.
+    auto render(const std::string& format, std::ostream& out) const -> bool;
+
+    /// Save the plot in a file in a background thread, returning immediately with the future result of @ref save.
+    /// The plot is copied first with temporary files of its own, and the data of views (see @ref view) is copied too, so the plot
+    /// and the viewed vectors can be changed or destroyed right away, and the plot can be saved again before the returned future is ready.
+    /// @note As with any future returned by `std::async`, destroying the returned future waits for the save to complete.
+    auto saveAsync(std::string filename) const -> std::future<bool>;
 
     /// Write the current plot data to the data file.
+    /// The data sets are serialized and streamed into the data file(s) in chunks of fixed size, so that no full copy of the file contents is kept in memory.
     auto savePlotData() const -> void;
 
     /// Toggle automatic cleaning of temporary files (enabled by default). Pass false if you want to keep your script / data files.
     /// Call cleanup() to remove those files manually.
     auto autoclean(bool enable = true) -> void;
 
+    /// Toggle binary mode for the data of subsequent draw calls with vectors (disabled by default).
+    /// In binary mode, numeric vectors are saved as raw little-endian doubles (or floats) in a separate binary data file,
+    /// which is much faster to write and to be read by gnuplot than text. Data sets containing strings are always saved as text.
+    auto binaryData(bool enable = true) -> void;
+
+    /// Toggle inline mode for the data of subsequent draw calls with vectors (disabled by default).
+    /// In inline mode, data sets are embedded at the top of the script as gnuplot datablocks (`$DATA_0`, `$DATA_1`, ...)
+    /// instead of being saved in the data file. No data file is then written, and saving with a @ref GnuplotSession
+    /// does not touch the disk at all. This takes precedence over @ref binaryData.
+    auto inlineData(bool enable = true) -> void;
+
+    /// Set the render cache used by @ref save to restore the plot instead of running gnuplot, if it was already saved
+    /// with the same terminal settings, script and data (see @ref RenderCache). Pass nullptr to disable caching (the default).
+    auto renderCache(std::shared_ptr<RenderCache> cache) -> void;
+
+    /// Set a function called with the wall time and byte counts of the phases of every call to @ref save, @ref show, @ref render
+    /// and @ref savePlotData (see @ref RenderStats). Pass nullptr to disable it (the default).
+    /// @note The function is called by the thread that saves the plot (e.g., a background thread for @ref saveAsync).
+    auto renderCallback(RenderCallback callback) -> void;
+
+    /// Set the wall time, CPU time and memory limits of the gnuplot processes run by @ref save and @ref show (see @ref RenderLimits).
+    /// A render exceeding its timeout is killed and throws @ref RenderTimeout, after its files are removed and its stats are reported.
+    auto renderLimits(RenderLimits limits) -> void;
+
+    /// Return a hash of the plot commands and data, which does not depend on the names of the temporary files of the plot.
+    auto renderKey() const -> std::uint64_t;
+
     /// Delete all files used to store plot data or scripts.
     auto cleanup() const -> void;
 
-    /// Clear all draw and gnuplot commands.
+    /// Clear all draw and gnuplot commands, as well as the data sets they use.
     /// @note This method leaves all other plot properties untouched.
     auto clear() -> void;
 
@@ -413,16 +510,55 @@ class Plot
     auto repr() const -> std::string;
 
   private:
-    static std::size_t m_counter;          ///< Counter of how many plot / singleplot objects have been instanciated in the application
+    friend class Figure;
+    friend class RenderPool;
+
+    /// Give the plot a new id, and thus new names for its temporary files, pointing its draw specs to the new data files.
+    /// A copy of the plot rendered while the original (or another copy) may be rendered too must not share their temporary files.
+    auto renewid() -> void;
+
+    /// Return a copy of the plot to be rendered in the background (see @ref saveAsync): with a new id (see @ref renewid),
+    /// and with copies of the data sets holding views of vectors, which may be changed or destroyed before the render.
+    auto snapshot() const -> Plot;
+
+    /// Convert this plot object into a gnuplot formatted string with given draw specs instead of its own ones.
+    auto repr(const std::vector<DrawSpecs>& drawspecs) const -> std::string;
+
+    /// Write the data sets of the plot to the data files, and return the number of bytes written.
+    auto writeplotdata() const -> std::size_t;
+
+    /// Write the binary data sets of the plot to the binary data file, and return the number of bytes written.
+    auto savebinaryplotdata() const -> std::size_t;
+
+    /// Return the steps of a render of the plot shared by all operations (see @ref internal::render): writing the data files,
+    /// using the render cache, removing the temporary files if autoclean is enabled, and reporting to the render callback.
+    auto rendersteps(std::string operation) const -> internal::RenderSteps;
+
+    /// Write the gnuplot commands that render the plot in given format (e.g., "pdf") to an output file (or to the standard output of gnuplot
+    /// if the file name is empty) into an ostream object, with given plot commands (see @ref repr).
+    auto savescript(std::ostream& script, const std::string& format, const std::string& output, const std::string& plotcmds) const -> void;
+
+    /// Return the key of the plot saved in a file with given name in the render cache.
+    auto rendercachekey(const std::string& filename) const -> std::uint64_t;
+
+    static std::atomic<std::size_t> m_counter; ///< Counter of how many plot / singleplot objects have been instanciated in the application (atomic, so that plots can be constructed concurrently)
     std::size_t m_id = 0;                  ///< The Plot id derived from m_counter upon construction (must be the first member due to constructor initialization order!)
     bool m_autoclean = true;               ///< Toggle automatic cleaning of temporary files (enabled by default)
+    bool m_binarydata = false;             ///< Toggle binary mode for the data of subsequent draw calls with vectors (disabled by default)
+    bool m_inlinedata = false;             ///< Toggle inline mode for the data of subsequent draw calls with vectors (disabled by default)
     std::string m_palette;                 ///< The name of the gnuplot palette to be used
     std::size_t m_width = 0;               ///< The size of the plot in x
     std::size_t m_height = 0;              ///< The size of the plot in y
     std::string m_scriptfilename;          ///< The name of the file where the plot commands are saved
     std::string m_datafilename;            ///< The multi data set file where data given to plot (e.g., vectors) are saved
-    std::string m_data;                    ///< The current plot data as a string
-    std::size_t m_numdatasets = 0;         ///< The current number of data sets in the data file
+    std::string m_bindatafilename;         ///< The file where data sets saved in binary mode are saved
+    std::vector<std::shared_ptr<const internal::DataSet>> m_datasets;    ///< The data sets saved as text in the data file
+    std::vector<std::shared_ptr<const internal::DataSet>> m_bindatasets; ///< The data sets saved in binary mode in the binary data file
+    std::size_t m_bindatasize = 0;         ///< The current number of bytes in the binary data file
+    std::vector<std::shared_ptr<const internal::DataSet>> m_inlinedatasets; ///< The data sets embedded in the script as datablocks in inline mode
+    std::shared_ptr<RenderCache> m_rendercache; ///< The render cache used to skip gnuplot when the plot was already saved (if any)
+    RenderCallback m_rendercallback;       ///< The function called with the stats of every render (if any)
+    RenderLimits m_renderlimits;           ///< The limits of the gnuplot processes rendering the plot
     std::string m_xrange;                  ///< The x-range of the plot as a gnuplot formatted string (e.g., "set xrange [0:1]")
     std::string m_yrange;                  ///< The y-range of the plot as a gnuplot formatted string (e.g., "set yrange [0:1]")
     FontSpecs m_font;                      ///< The font name and size in the plot
@@ -445,22 +581,26 @@ class Plot
     TicsSpecsMinor m_rtics_minor;          ///< The specs for the minor rtics.
     LegendSpecs m_legend;                  ///< The legend specs of the plot
     std::string m_samples;                 ///< The number of sample points for functions
+    std::size_t m_downsample = 0;          ///< The maximum number of points of curves drawn with drawCurve (0 if curves are not downsampled)
+    bool m_downsampleminmax = false;       ///< Toggle pixel-aware min/max (M4) aggregation of curves drawn with drawCurve
     AxisLabelSpecs m_xlabel;               ///< The label of the x-axis
     AxisLabelSpecs m_ylabel;               ///< The label of the y-axis
     AxisLabelSpecs m_zlabel;               ///< The label of the z-axis
     AxisLabelSpecs m_rlabel;               ///< The label of the r-axis
     std::string m_boxwidth;                ///< The default width of boxes in plots containing boxes without given widths.
     std::vector<DrawSpecs> m_drawspecs;    ///< The plot specs for each call to gnuplot plot function
+    std::vector<std::size_t> m_drawdatasets; ///< The index in m_datasets of the data set drawn by each draw spec (npos if it draws no data set saved as text)
     std::vector<std::string> m_customcmds; ///< The strings containing gnuplot custom commands
 };
 
 // Initialize the counter of plot objects
-inline std::size_t Plot::m_counter = 0;
+inline std::atomic<std::size_t> Plot::m_counter{0};
 
 inline Plot::Plot()
 : m_id(m_counter++),
-  m_scriptfilename("show" + internal::str(m_id) + ".plt"),
-  m_datafilename("plot" + internal::str(m_id) + ".dat"),
+  m_scriptfilename(internal::scratchfilename("show", m_id, ".plt")),
+  m_datafilename(internal::scratchfilename("plot", m_id, ".dat")),
+  m_bindatafilename(internal::scratchfilename("plot", m_id, ".bin")),
   m_xtics_major_bottom("x"),
   m_xtics_major_top("x2"),
   m_xtics_minor_bottom("x"),
@@ -568,6 +708,7 @@ inline auto Plot::draw(std::string what, std::string use, std::string with) -> D
 {
     // Save the draw arguments for this x,y data
     m_drawspecs.emplace_back(what, use, with);
+    m_drawdatasets.push_back(std::string::npos);
 
     // Set the default line style specification for this drawing (desired behavior is 1, 2, 3 (incrementing as new lines are plotted))
     m_drawspecs.back().lineStyle(m_drawspecs.size());
@@ -579,9 +720,10 @@ inline auto Plot::draw(std::string what, std::string use, std::string with) -> D
 template <typename X, typename... Vecs>
 inline auto Plot::drawWithVecs(std::string with, const X& x, const Vecs&... vecs) -> DrawSpecs&
 {
-    // Write the given vectors x and y as a new data set to the stream
-    std::ostringstream datastream;
-    gnuplot::writedataset(datastream, m_numdatasets, x, vecs...);
+    internal::TraceScope trace("Plot::drawWithVecs");
+
+    // Store the given vectors (or views of them) as a new data set, which is only serialized when the plot data is saved
+    auto dataset = internal::makedataset(x, vecs...);
 
     // Set the using string to "" if X is not vector of strings.
     // Otherwise, x contain xtics strings. Set the `using` string
@@ -595,16 +737,48 @@ inline auto Plot::drawWithVecs(std::string with, const X& x, const Vecs&... vecs
         use += "xtic(1)"; // this terminates the string with 0:2:3:4:xtic(1), and thus column 1 is used for the xtics
     }
 
-    // Append new data set to existing data
-    m_data += datastream.str();
+    // In inline mode, draw the data set from a named datablock embedded in the script (see repr)
+    if(m_inlinedata) {
+        m_inlinedatasets.push_back(dataset);
+        return draw("$DATA_" + internal::str(m_inlinedatasets.size() - 1), use, with);
+    }
+
+    // In binary mode, draw numeric data sets from their raw records in the binary data file
+    if constexpr(internal::isNumberVector<X> && (internal::isNumberVector<Vecs> && ...)) {
+        if(m_binarydata) {
+            const auto offset = m_bindatasize;
+            m_bindatasize += dataset->size() * dataset->recordsize();
+            m_bindatasets.push_back(dataset);
+            return draw(gnuplot::binarydatasetstr(m_bindatafilename, offset, dataset->size(), dataset->binaryformat()), "", with);
+        }
+    }
 
-    // Draw the data saved using a data set with index `m_numdatasets`. Increase number of data sets
-    return draw("'" + m_datafilename + "' index " + internal::str(m_numdatasets++), use, with);
+    // Append new data set to existing data sets
+    m_datasets.push_back(dataset);
+
+    // Draw the data saved using a data set with index equal to its position in the data file
+    auto& drawspecs = draw("'" + m_datafilename + "' index " + internal::str(m_datasets.size() - 1), use, with);
+    m_drawdatasets.back() = m_datasets.size() - 1;
+    return drawspecs;
 }
 
 template <typename X, typename Y>
 inline auto Plot::drawCurve(const X& x, const Y& y) -> DrawSpecs&
 {
+    // Draw only the points selected by the M4 aggregation or the LTTB algorithm if the curve is too long
+    if constexpr(internal::isNumberVector<X> && internal::isNumberVector<Y>) {
+        if(m_downsampleminmax) {
+            const auto width = m_width == 0 ? internal::DEFAULT_FIGURE_WIDTH : m_width;
+            const auto indices = internal::m4(x, y, static_cast<std::size_t>(width));
+            if(indices.size() < internal::minsize(x, y)) // otherwise all points are kept, and views are drawn without copies
+                return drawWithVecs("lines", internal::gather(x, indices), internal::gather(y, indices));
+            return drawWithVecs("lines", x, y);
+        }
+        if(m_downsample > 0 && internal::minsize(x, y) > m_downsample) {
+            const auto indices = internal::lttb(x, y, m_downsample);
+            return drawWithVecs("lines", internal::gather(x, indices), internal::gather(y, indices));
+        }
+    }
     return drawWithVecs("lines", x, y);
 }
 
@@ -927,6 +1101,16 @@ inline auto Plot::samples(std::size_t value) -> void
     m_samples = internal::str(value);
 }
 
+inline auto Plot::downsample(std::size_t npoints) -> void
+{
+    m_downsample = npoints;
+}
+
+inline auto Plot::downsampleMinMax(bool enable) -> void
+{
+    m_downsampleminmax = enable;
+}
+
 inline auto Plot::gnuplot(std::string command) -> void
 {
     m_customcmds.push_back(command);
@@ -934,48 +1118,108 @@ inline auto Plot::gnuplot(std::string command) -> void
 
 inline auto Plot::show() const -> void
 {
-    // Open script file and truncate it
-    std::ofstream script(m_scriptfilename);
+    internal::TraceScope trace("Plot::show");
+    auto steps = rendersteps("show");
+    steps.writescript = [&](const std::vector<std::string>&) {
+        // Open script file and truncate it
+        std::ofstream script(m_scriptfilename);
 
-    // Add palette info. Use default palette if the user hasn't set one
-    gnuplot::palettecmd(script, m_palette.empty() ? internal::DEFAULT_PALETTE : m_palette);
+        // Add palette info. Use default palette if the user hasn't set one
+        gnuplot::palettecmd(script, m_palette.empty() ? internal::DEFAULT_PALETTE : m_palette);
 
-    // Add terminal info
-    auto width = m_width == 0 ? internal::DEFAULT_FIGURE_WIDTH : m_width;
-    auto height = m_height == 0 ? internal::DEFAULT_FIGURE_HEIGHT : m_height;
-    std::string size = gnuplot::sizestr(width, height, false);
-    gnuplot::showterminalcmd(script, size, m_font);
+        // Add terminal info
+        auto width = m_width == 0 ? internal::DEFAULT_FIGURE_WIDTH : m_width;
+        auto height = m_height == 0 ? internal::DEFAULT_FIGURE_HEIGHT : m_height;
+        std::string size = gnuplot::sizestr(width, height, false);
+        gnuplot::showterminalcmd(script, size, m_font);
 
-    // Add the plot commands
-    script << repr();
+        // Add the plot commands
+        script << repr();
 
-    // Add an empty line at the end and close the script to avoid crashes with gnuplot
-    script << std::endl;
-    script.close();
+        // Add an empty line at the end to avoid crashes with gnuplot
+        script << std::endl;
+        return script ? static_cast<std::size_t>(script.tellp()) : 0;
+    };
+    steps.rungnuplot = [&] { return gnuplot::runscript(m_scriptfilename, true, m_renderlimits); };
+    internal::render(steps);
+}
 
-    // save plot data to a file
-    savePlotData();
+inline auto Plot::save(std::string filename) const -> bool
+{
+    return save(std::vector<std::string>{ std::move(filename) });
+}
 
-    // Show the plot
-    gnuplot::runscript(m_scriptfilename, true);
+inline auto Plot::save(std::initializer_list<std::string> filenames) const -> bool
+{
+    return save(std::vector<std::string>(filenames));
+}
 
-    // remove the temporary files if user wants to
-    if(m_autoclean)
-    {
-        cleanup();
-    }
+inline auto Plot::save(const std::vector<std::string>& filenames) const -> bool
+{
+    internal::TraceScope trace("Plot::save");
+    auto steps = rendersteps("save");
+    steps.filenames = filenames;
+    steps.writescript = [&](const std::vector<std::string>& pending) {
+        // Open script file and write the commands that save the plot into it, replotting it for each other file
+        std::ofstream script(m_scriptfilename);
+        for(std::size_t i = 0; i < pending.size(); ++i)
+            savescript(script, gnuplot::fileformat(pending[i]), pending[i], i == 0 ? repr() : "replot\n");
+        return script ? static_cast<std::size_t>(script.tellp()) : 0;
+    };
+    steps.rungnuplot = [&] { return gnuplot::runscript(m_scriptfilename, false, m_renderlimits); };
+    return internal::render(steps);
 }
 
-inline auto Plot::save(std::string filename) const -> void
+inline auto Plot::save(std::string filename, GnuplotSession& session) const -> bool
 {
-    // Clean the file name to prevent errors
-    auto cleanedfilename = gnuplot::cleanpath(filename);
+    internal::TraceScope trace("Plot::save");
+    std::string commands;
+    auto steps = rendersteps("save");
+    steps.filenames = { filename };
+    steps.writescript = [&](const std::vector<std::string>&) {
+        // Write the commands that save the plot into a string, which is sent to gnuplot instead of a script file
+        std::ostringstream script;
+        savescript(script, gnuplot::fileformat(filename), filename, repr());
+        commands = script.str();
+        return commands.size();
+    };
+    steps.rungnuplot = [&] { return internal::runsession(session, commands, m_renderlimits); };
+    return internal::render(steps);
+}
 
-    // Get extension from file name
-    auto extension = cleanedfilename.substr(cleanedfilename.rfind(".") + 1);
+inline auto Plot::render(const std::string& format) const -> std::vector<std::byte>
+{
+    std::vector<std::byte> bytes;
+    internal::ByteVectorBuffer buffer(bytes);
+    std::ostream out(&buffer);
+    if(!render(format, out))
+        bytes.clear();
+    return bytes;
+}
 
-    // Open script file
-    std::ofstream script(m_scriptfilename);
+inline auto Plot::render(const std::string& format, std::ostream& out) const -> bool
+{
+    internal::TraceScope trace("Plot::render");
+    auto steps = rendersteps("render");
+    steps.writescript = [&](const std::vector<std::string>&) {
+        // Open script file and write the commands that render the plot to the standard output of gnuplot into it
+        std::ofstream script(m_scriptfilename);
+        savescript(script, format, "", repr());
+        return script ? static_cast<std::size_t>(script.tellp()) : 0;
+    };
+    steps.rungnuplot = [&] { return gnuplot::runscript(m_scriptfilename, out, m_renderlimits); };
+    return internal::render(steps);
+}
+
+inline auto Plot::saveAsync(std::string filename) const -> std::future<bool>
+{
+    return std::async(std::launch::async, [plot = snapshot(), filename] { return plot.save(filename); });
+}
+
+inline auto Plot::savescript(std::ostream& script, const std::string& format, const std::string& output, const std::string& plotcmds) const -> void
+{
+    // Clean the file name to prevent errors
+    auto cleanedfilename = gnuplot::cleanpath(output);
 
     // Add palette info. Use default palette if the user hasn't set one
     gnuplot::palettecmd(script, m_palette.empty() ? internal::DEFAULT_PALETTE : m_palette);
@@ -983,44 +1227,87 @@ inline auto Plot::save(std::string filename) const -> void
     // Add terminal info
     auto width = m_width == 0 ? internal::DEFAULT_FIGURE_WIDTH : m_width;
     auto height = m_height == 0 ? internal::DEFAULT_FIGURE_HEIGHT : m_height;
-    std::string size = gnuplot::sizestr(width, height, extension == "pdf");
-    gnuplot::saveterminalcmd(script, extension, size, m_font);
+    std::string size = gnuplot::sizestr(width, height, format == "pdf");
+    gnuplot::saveterminalcmd(script, format, size, m_font);
 
     // Add output command
     gnuplot::outputcmd(script, cleanedfilename);
 
     // Add the plot commands
-    script << repr();
+    script << plotcmds;
 
     // Unset the output
     script << std::endl;
     script << "set output";
 
-    // Add an empty line at the end and close the script to avoid crashes with gnuplot
+    // Add an empty line at the end to avoid crashes with gnuplot
     script << std::endl;
-    script.close();
+}
 
-    // save plot data to a file
-    savePlotData();
+inline auto Plot::rendercachekey(const std::string& filename) const -> std::uint64_t
+{
+    // Hash the script without the plot commands (e.g., palette and terminal), with a placeholder for the output file name
+    const auto cleanedfilename = gnuplot::cleanpath(filename);
+    const auto extension = gnuplot::fileformat(cleanedfilename);
+    std::ostringstream script;
+    savescript(script, extension, "output." + extension, "");
 
-    // Save the plot as a file
-    gnuplot::runscript(m_scriptfilename, false);
+    // Combine it with the hash of the plot commands and data
+    return internal::hashcombine(internal::fnv1a(script.str()), renderKey());
+}
 
-    // remove the temporary files if user wants to
-    if (m_autoclean)
+inline auto Plot::savePlotData() const -> void
+{
+    internal::Stopwatch stopwatch;
+    RenderStats stats;
+    stats.operation = "saveplotdata";
+    stats.databytes = writeplotdata();
+    stats.datatime = stopwatch.lap();
+    stats.success = true;
+    internal::reportstats(stats, stopwatch, m_rendercallback);
+}
+
+inline auto Plot::writeplotdata() const -> std::size_t
+{
+    internal::TraceScope trace("Plot::savePlotData");
+    std::size_t numbytes = 0;
+
+    // Open data file, truncate it and write all current data sets to it
+    if(!m_datasets.empty())
     {
-        cleanup();
+        std::ofstream data(m_datafilename);
+        for(std::size_t i = 0; i < m_datasets.size(); ++i)
+            gnuplot::writedataset(data, i, *m_datasets[i]);
+        numbytes += data ? static_cast<std::size_t>(data.tellp()) : 0;
     }
+
+    return numbytes + savebinaryplotdata();
 }
 
-inline auto Plot::savePlotData() const -> void
+inline auto Plot::savebinaryplotdata() const -> std::size_t
 {
-    // Open data file, truncate it and write all current plot data to it
-    if(!m_data.empty())
+    // Open binary data file, truncate it and write all current binary data sets to it
+    if(!m_bindatasets.empty())
     {
-        std::ofstream data(m_datafilename);
-        data << m_data;
+        std::ofstream data(m_bindatafilename, std::ios::binary);
+        for(const auto& dataset : m_bindatasets)
+            gnuplot::writebinarydataset(data, *dataset);
+        return data ? static_cast<std::size_t>(data.tellp()) : 0;
     }
+    return 0;
+}
+
+inline auto Plot::rendersteps(std::string operation) const -> internal::RenderSteps
+{
+    internal::RenderSteps steps;
+    steps.operation = std::move(operation);
+    steps.cache = m_rendercache.get();
+    steps.cachekey = [this](const std::string& filename) { return rendercachekey(filename); };
+    steps.writedata = [this] { return writeplotdata(); };
+    if(m_autoclean)
+        steps.cleanup = [this] { cleanup(); };
+    steps.callback = m_rendercallback;
+    return steps;
 }
 
 inline auto Plot::autoclean(bool enable) -> void
@@ -1028,79 +1315,179 @@ inline auto Plot::autoclean(bool enable) -> void
     m_autoclean = enable;
 }
 
+inline auto Plot::binaryData(bool enable) -> void
+{
+    m_binarydata = enable;
+}
+
+inline auto Plot::inlineData(bool enable) -> void
+{
+    m_inlinedata = enable;
+}
+
+inline auto Plot::renderCache(std::shared_ptr<RenderCache> cache) -> void
+{
+    m_rendercache = std::move(cache);
+}
+
+inline auto Plot::renderCallback(RenderCallback callback) -> void
+{
+    m_rendercallback = std::move(callback);
+}
+
+inline auto Plot::renderLimits(RenderLimits limits) -> void
+{
+    m_renderlimits = limits;
+}
+
+inline auto Plot::renderKey() const -> std::uint64_t
+{
+    // Hash the plot commands with placeholders for the names of the temporary data files, which change from run to run
+    auto script = repr();
+    script = internal::replaceall(script, m_datafilename, "sciplot-data");
+    script = internal::replaceall(script, m_bindatafilename, "sciplot-binary-data");
+    auto hash = internal::fnv1a(script);
+
+    // Combine it with the contents of the data sets saved in the data files
+    for(const auto& dataset : m_datasets)
+        hash = internal::hashcombine(hash, dataset->hash());
+    for(const auto& dataset : m_bindatasets)
+        hash = internal::hashcombine(hash, dataset->hash());
+    return hash;
+}
+
+inline auto Plot::renewid() -> void
+{
+    const auto datafile = "'" + m_datafilename + "'";
+    const auto bindatafile = "'" + m_bindatafilename + "'";
+
+    m_id = m_counter++;
+    m_scriptfilename = internal::scratchfilename("show", m_id, ".plt");
+    m_datafilename = internal::scratchfilename("plot", m_id, ".dat");
+    m_bindatafilename = internal::scratchfilename("plot", m_id, ".bin");
+
+    for(auto& drawspecs : m_drawspecs)
+    {
+        const auto what = drawspecs.what();
+        if(what.compare(0, datafile.size(), datafile) == 0)
+            drawspecs.what("'" + m_datafilename + "'" + what.substr(datafile.size()));
+        else if(what.compare(0, bindatafile.size(), bindatafile) == 0)
+            drawspecs.what("'" + m_bindatafilename + "'" + what.substr(bindatafile.size()));
+    }
+}
+
+inline auto Plot::snapshot() const -> Plot
+{
+    // The data sets without views are immutable, so they are shared with the copy instead of being copied again
+    Plot plot = *this;
+    plot.renewid();
+    for(auto* datasets : { &plot.m_datasets, &plot.m_bindatasets, &plot.m_inlinedatasets })
+        for(auto& dataset : *datasets)
+            if(auto copy = dataset->ownedcopy())
+                dataset = std::move(copy);
+    return plot;
+}
+
 inline auto Plot::cleanup() const -> void
 {
+    internal::TraceScope trace("Plot::cleanup");
     std::remove(m_scriptfilename.c_str());
     std::remove(m_datafilename.c_str());
+    std::remove(m_bindatafilename.c_str());
 }
 
 inline auto Plot::clear() -> void
 {
     m_drawspecs.clear();
+    m_drawdatasets.clear();
     m_customcmds.clear();
+    m_datasets.clear();
+    m_bindatasets.clear();
+    m_bindatasize = 0;
+    m_inlinedatasets.clear();
 }
 
 inline auto Plot::repr() const -> std::string
 {
-    std::stringstream script;
+    return repr(m_drawspecs);
+}
+
+inline auto Plot::repr(const std::vector<DrawSpecs>& drawspecs) const -> std::string
+{
+    internal::TraceScope trace("Plot::repr");
+
+    // Reserve room for the setup commands and the plot commands, which are appended to a single buffer
+    internal::ScriptBuilder script(4096 + 256 * drawspecs.size());
+
+    // Add the data sets embedded in the script in inline mode
+    if(!m_inlinedatasets.empty())
+    {
+        script << "#==============================================================================\n";
+        script << "# DATABLOCKS\n";
+        script << "#==============================================================================\n";
+        internal::ScriptBuilderBuffer buffer(script);
+        std::ostream out(&buffer);
+        for(std::size_t i = 0; i < m_inlinedatasets.size(); ++i)
+            gnuplot::writedatablock(out, "$DATA_" + internal::str(i), *m_inlinedatasets[i]);
+    }
 
     // Add plot setup commands
-    script << "#==============================================================================" << std::endl;
-    script << "# SETUP COMMANDS" << std::endl;
-    script << "#==============================================================================" << std::endl;
-    script << gnuplot::commandValueStr("set xrange", m_xrange);
-    script << gnuplot::commandValueStr("set yrange", m_yrange);
-    script << m_xlabel << std::endl;
-    script << m_ylabel << std::endl;
-    script << m_zlabel << std::endl;
-    script << m_rlabel << std::endl;
-    script << m_border << std::endl;
-    script << m_grid << std::endl;
-    script << m_style_fill << std::endl;
-    script << m_style_histogram << std::endl;
-    script << m_tics << std::endl;
-    script << m_xtics_major_bottom << std::endl;
-    script << m_xtics_major_top << std::endl;
-    script << m_xtics_minor_bottom << std::endl;
-    script << m_xtics_minor_top << std::endl;
-    script << m_ytics_major_left << std::endl;
-    script << m_ytics_major_right << std::endl;
-    script << m_ytics_minor_left << std::endl;
-    script << m_ytics_minor_right << std::endl;
-    script << m_ztics_major << std::endl;
-    script << m_ztics_minor << std::endl;
-    script << m_rtics_major << std::endl;
-    script << m_rtics_minor << std::endl;
-    script << m_legend << std::endl;
-    script << gnuplot::commandValueStr("set boxwidth", m_boxwidth);
-    script << gnuplot::commandValueStr("set samples", m_samples);
+    script << "#==============================================================================\n";
+    script << "# SETUP COMMANDS\n";
+    script << "#==============================================================================\n";
+    script.command("set xrange", m_xrange);
+    script.command("set yrange", m_yrange);
+    script << m_xlabel << '\n';
+    script << m_ylabel << '\n';
+    script << m_zlabel << '\n';
+    script << m_rlabel << '\n';
+    script << m_border << '\n';
+    script << m_grid << '\n';
+    script << m_style_fill << '\n';
+    script << m_style_histogram << '\n';
+    script << m_tics << '\n';
+    script << m_xtics_major_bottom << '\n';
+    script << m_xtics_major_top << '\n';
+    script << m_xtics_minor_bottom << '\n';
+    script << m_xtics_minor_top << '\n';
+    script << m_ytics_major_left << '\n';
+    script << m_ytics_major_right << '\n';
+    script << m_ytics_minor_left << '\n';
+    script << m_ytics_minor_right << '\n';
+    script << m_ztics_major << '\n';
+    script << m_ztics_minor << '\n';
+    script << m_rtics_major << '\n';
+    script << m_rtics_minor << '\n';
+    script << m_legend << '\n';
+    script.command("set boxwidth", m_boxwidth);
+    script.command("set samples", m_samples);
 
     // Add custom gnuplot commands
     if (!m_customcmds.empty())
     {
-        script << "#==============================================================================" << std::endl;
-        script << "# CUSTOM EXPLICIT GNUPLOT COMMANDS" << std::endl;
-        script << "#==============================================================================" << std::endl;
+        script << "#==============================================================================\n";
+        script << "# CUSTOM EXPLICIT GNUPLOT COMMANDS\n";
+        script << "#==============================================================================\n";
         for(const auto& c : m_customcmds)
         {
-            script << c << std::endl;
+            script << c << '\n';
         }
     }
 
     // Add the actual plot commands for all drawXYZ() calls
-    script << "#==============================================================================" << std::endl;
-    script << "# PLOT COMMANDS" << std::endl;
-    script << "#==============================================================================" << std::endl;
+    script << "#==============================================================================\n";
+    script << "# PLOT COMMANDS\n";
+    script << "#==============================================================================\n";
     script << "plot \\\n"; // use `\` to have a plot command in each individual line!
 
     // Write plot commands and style per plot
-    const auto n = m_drawspecs.size();
+    const auto n = drawspecs.size();
     for(std::size_t i = 0; i < n; ++i)
-        script << "    " << m_drawspecs[i] << (i < n - 1 ? ", \\\n" : ""); // consider indentation with 4 spaces!
+        script << "    " << drawspecs[i] << (i < n - 1 ? ", \\\n" : ""); // consider indentation with 4 spaces!
 
     // Add an empty line at the end
-    script << std::endl;
-    return script.str();
+    script << '\n';
+    return script.release();
 }
 
 } // namespace sciplot
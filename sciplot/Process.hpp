@@ -0,0 +1,532 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+// POSIX includes
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+extern char** environ;
+#endif
+
+// sciplot includes
+#include <sciplot/RenderLimits.hpp>
+
+namespace sciplot {
+namespace internal {
+
+/// The standard streams of a child process that can be connected to pipes (combine them with `|`).
+enum ProcessPipe
+{
+    PipeInput = 1,  ///< Connect the standard input of the child process to a pipe written with @ref Process::write.
+    PipeOutput = 2, ///< Connect the standard output of the child process to a pipe read with @ref Process::readline.
+    PipeError = 4,  ///< Connect the standard error of the child process to a pipe read with @ref Process::readline.
+};
+
+/// A child process, started without a shell, whose standard streams may be connected to pipes.
+/// @note Child processes are only supported on POSIX systems; @ref start always fails on Windows.
+class Process
+{
+  public:
+    /// The type of the deadlines of the calls that wait for the child process.
+    using Deadline = std::chrono::steady_clock::time_point;
+
+    /// Construct a Process object without any child process.
+    Process() = default;
+
+    /// Destroy this Process object, closing its pipes and waiting for the child process to exit.
+    ~Process() { wait(); }
+
+    Process(const Process&) = delete;
+    auto operator=(const Process&) -> Process& = delete;
+
+    /// Start a child process with given command-line arguments (the program is searched in PATH) and the given pipes.
+    /// Return false if the child process could not be started (e.g., the program was not found).
+    auto start(const std::vector<std::string>& args, int pipes) -> bool;
+
+    /// Return true if a child process was started and has not been waited for.
+    auto running() const -> bool { return m_pid != -1; }
+
+    /// Write the given text to the standard input of the child process.
+    /// The standard output and error of the child process, if piped, are buffered while writing, so that the child process never
+    /// blocks on a full pipe while this process waits for it to read its standard input.
+    /// Return false if the child process has closed its standard input (e.g., because it has exited) or the deadline has passed.
+    auto write(const std::string& text, Deadline deadline = Deadline::max()) -> bool;
+
+    /// Read the next line (without its line break) from the standard output or error (@ref PipeOutput or @ref PipeError).
+    /// Return false if the end of the stream was reached (e.g., because the child process has exited) or the deadline has passed.
+    auto readline(ProcessPipe pipe, std::string& line, Deadline deadline = Deadline::max()) -> bool;
+
+    /// Read the next bytes available from the standard output or error (@ref PipeOutput or @ref PipeError), replacing the given chunk.
+    /// Return false if the end of the stream was reached (e.g., because the child process has exited) or the deadline has passed.
+    auto read(ProcessPipe pipe, std::string& chunk, Deadline deadline = Deadline::max()) -> bool;
+
+    /// Close the standard input of the child process, so that it reads an end of file.
+    auto closeinput() -> void;
+
+    /// Limit the CPU time (in seconds) and the address space (in bytes) of the child process (0 for no limit).
+    /// Return false if the limits could not be applied (they are only supported on Linux).
+    /// @note The limits are applied to the running child process, since posix_spawn cannot set them. The child process thus runs
+    /// without limits in the short window between being spawned and this call (for gnuplot, before it even reads its script).
+    auto limit(std::uint64_t cputime, std::uint64_t memory) -> bool;
+
+    /// Wait until the child process exits or the deadline passes, whichever comes first, without closing any pipe.
+    /// The standard error of the child process, if piped, is buffered meanwhile, so that the child process never blocks on a full pipe.
+    /// Return false if the deadline passed before the child process exited.
+    auto waituntil(Deadline deadline) -> bool;
+
+    /// Kill the child process with SIGKILL (it must still be waited for with @ref wait).
+    auto kill() -> void;
+
+    /// Close all pipes, wait for the child process to exit, and return its exit code (-1 if it was killed by a signal or not running).
+    auto wait() -> int;
+
+  private:
+    int m_pid = -1;           ///< The id of the child process (-1 if there is none)
+    int m_exitcode = -1;      ///< The exit code of the child process, once it has been reaped by @ref waituntil
+    bool m_exited = false;    ///< True if the child process has been reaped by @ref waituntil but not yet waited for
+    int m_input = -1;         ///< The file descriptor of the pipe connected to the standard input of the child process
+    int m_output = -1;        ///< The file descriptor of the pipe connected to the standard output of the child process
+    int m_error = -1;         ///< The file descriptor of the pipe connected to the standard error of the child process
+    std::string m_outputbuf;  ///< The bytes read from the standard output of the child process that are not yet returned
+    std::string m_errorbuf;   ///< The bytes read from the standard error of the child process that are not yet returned
+};
+
+/// Return the deadline of a timeout in seconds starting now (no deadline if the timeout is not positive).
+inline auto deadlineafter(double timeout) -> Process::Deadline
+{
+    if(timeout <= 0.0)
+        return Process::Deadline::max();
+    return std::chrono::steady_clock::now() + std::chrono::duration_cast<Process::Deadline::duration>(std::chrono::duration<double>(timeout));
+}
+
+/// The result of a child process run to completion by @ref runprocess.
+struct ProcessResult
+{
+    bool started = false;      ///< True if the child process could be started
+    bool timedout = false;     ///< True if the child process was killed after exceeding its timeout
+    bool limitsfailed = false; ///< True if the requested resource limits could not be applied to the child process (see @ref Process::limit)
+    int status = -1;           ///< The exit code of the child process (-1 if it was killed by a signal or could not be started)
+    std::string error;         ///< The standard error of the child process, if it was captured
+};
+
+/// Run a program with given command-line arguments (searched in PATH and started without a shell) and wait for it to exit.
+/// Unless @p captureerror is true, the standard error of the child process is inherited from this process.
+/// The child process is killed if it exceeds the timeout of the given limits, and its resources are limited as requested.
+inline auto runprocess(const std::vector<std::string>& args, bool captureerror = false, const RenderLimits& limits = {}) -> ProcessResult
+{
+    ProcessResult result;
+    Process process;
+    result.started = process.start(args, captureerror ? PipeError : 0);
+    if(!result.started)
+        return result;
+
+    result.limitsfailed = !process.limit(limits.cputime, limits.memory);
+
+    if(limits.timeout > 0.0 && !process.waituntil(deadlineafter(limits.timeout)))
+    {
+        process.kill();
+        result.timedout = true;
+    }
+
+    std::string line;
+    while(captureerror && process.readline(PipeError, line))
+        result.error += line + "\n";
+
+    result.status = process.wait();
+    return result;
+}
+
+#if !defined(_WIN32)
+
+/// Create a pipe whose file descriptors are closed in child processes spawned afterwards.
+inline auto cloexecpipe(int fds[2]) -> bool
+{
+#if defined(__linux__)
+    return pipe2(fds, O_CLOEXEC) == 0;
+#else
+    if(pipe(fds) != 0)
+        return false;
+    fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+    fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+    return true;
+#endif
+}
+
+/// Return the timeout of a call to poll ending at a deadline, rounding the remaining time up to milliseconds (-1 for no deadline).
+inline auto polltimeout(Process::Deadline deadline) -> int
+{
+    if(deadline == Process::Deadline::max())
+        return -1;
+    const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+    return static_cast<int>(std::clamp<decltype(remaining)>(remaining, 0, 1 << 30));
+}
+
+/// Wait until a file descriptor is readable or the deadline passes.
+/// Return false if the deadline passed first.
+inline auto pollreadable(int fd, Process::Deadline deadline) -> bool
+{
+    if(deadline == Process::Deadline::max())
+        return true;
+    while(true)
+    {
+        const auto timeout = polltimeout(deadline);
+        if(timeout == 0)
+            return false;
+        pollfd readable = { fd, POLLIN, 0 };
+        const auto ready = poll(&readable, 1, timeout);
+        if(ready > 0)
+            return true;
+        if(ready < 0 && errno != EINTR)
+            return true; // let the read report the error
+    }
+}
+
+/// Close a file descriptor, if valid, and invalidate it.
+inline auto closefd(int& fd) -> void
+{
+    if(fd != -1)
+        close(fd);
+    fd = -1;
+}
+
+/// Append the bytes available from a file descriptor, if valid, to a buffer without blocking, closing it at the end of its stream.
+inline auto readavailable(int& fd, std::string& buffer) -> void
+{
+    char chunk[4096];
+    pollfd readable = { fd, POLLIN, 0 };
+    while(fd != -1 && poll(&readable, 1, 0) > 0)
+    {
+        const auto n = ::read(fd, chunk, sizeof(chunk));
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n <= 0)
+        {
+            closefd(fd);
+            break;
+        }
+        buffer.append(chunk, static_cast<std::size_t>(n));
+    }
+}
+
+inline auto Process::start(const std::vector<std::string>& args, int pipes) -> bool
+{
+    wait();
+
+    if(args.empty())
+        return false;
+
+    // Create the requested pipes, with the parent ends closed in the child process
+    int input[2] = {-1, -1}, output[2] = {-1, -1}, error[2] = {-1, -1};
+    auto ok = true;
+    if(pipes & PipeInput) ok = ok && cloexecpipe(input);
+    if(pipes & PipeOutput) ok = ok && cloexecpipe(output);
+    if(pipes & PipeError) ok = ok && cloexecpipe(error);
+
+    // Connect the child ends of the pipes to the standard streams of the child process
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    if(pipes & PipeInput) posix_spawn_file_actions_adddup2(&actions, input[0], STDIN_FILENO);
+    if(pipes & PipeOutput) posix_spawn_file_actions_adddup2(&actions, output[1], STDOUT_FILENO);
+    if(pipes & PipeError) posix_spawn_file_actions_adddup2(&actions, error[1], STDERR_FILENO);
+
+    std::vector<char*> argv;
+    for(const auto& arg : args)
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    argv.push_back(nullptr);
+
+    pid_t pid = -1;
+    ok = ok && posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), environ) == 0;
+    posix_spawn_file_actions_destroy(&actions);
+
+    // Close the child ends of the pipes in this process
+    closefd(input[0]);
+    closefd(output[1]);
+    closefd(error[1]);
+
+    if(!ok)
+    {
+        closefd(input[1]);
+        closefd(output[0]);
+        closefd(error[0]);
+        return false;
+    }
+
+    // Write to the standard input without blocking, so that the other pipes can be drained meanwhile (see write)
+    if(input[1] != -1)
+        fcntl(input[1], F_SETFL, fcntl(input[1], F_GETFL) | O_NONBLOCK);
+
+    m_pid = pid;
+    m_input = input[1];
+    m_output = output[0];
+    m_error = error[0];
+    return true;
+}
+
+inline auto Process::write(const std::string& text, Deadline deadline) -> bool
+{
+    if(m_input == -1)
+        return false;
+
+    // Block SIGPIPE in this thread, so that writing to a child process that has exited fails with EPIPE instead of killing this process
+    sigset_t sigpipe, oldmask, pending;
+    sigemptyset(&sigpipe);
+    sigaddset(&sigpipe, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &sigpipe, &oldmask);
+    sigpending(&pending);
+    const auto waspending = sigismember(&pending, SIGPIPE);
+
+    auto data = text.data();
+    auto remaining = text.size();
+    auto ok = true;
+    while(remaining > 0)
+    {
+        // Wait until the standard input accepts more bytes, buffering the standard output and error meanwhile (closed pipes are -1, ignored by poll)
+        pollfd fds[3] = { { m_input, POLLOUT, 0 }, { m_output, POLLIN, 0 }, { m_error, POLLIN, 0 } };
+        const auto timeout = polltimeout(deadline);
+        const auto ready = timeout == 0 ? 0 : poll(fds, 3, timeout);
+        if(ready < 0 && errno == EINTR)
+            continue;
+        if(ready <= 0) // an error, or the deadline has passed
+        {
+            ok = false;
+            break;
+        }
+        if(fds[1].revents)
+            readavailable(m_output, m_outputbuf);
+        if(fds[2].revents)
+            readavailable(m_error, m_errorbuf);
+        if(!fds[0].revents)
+            continue;
+
+        const auto n = ::write(m_input, data, remaining);
+        if(n < 0 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK))
+            continue;
+        if(n < 0)
+        {
+            ok = false;
+            break;
+        }
+        data += n;
+        remaining -= static_cast<std::size_t>(n);
+    }
+
+    // Discard the SIGPIPE raised by a failed write before restoring the signal mask
+    if(!ok && errno == EPIPE && !waspending)
+    {
+        sigpending(&pending);
+        int sig = 0;
+        if(sigismember(&pending, SIGPIPE))
+            sigwait(&sigpipe, &sig);
+    }
+    pthread_sigmask(SIG_SETMASK, &oldmask, nullptr);
+
+    return ok;
+}
+
+inline auto Process::readline(ProcessPipe pipe, std::string& line, Deadline deadline) -> bool
+{
+    const auto fd = pipe == PipeOutput ? m_output : pipe == PipeError ? m_error : -1;
+    auto& buffer = pipe == PipeOutput ? m_outputbuf : m_errorbuf;
+    if(fd == -1 && buffer.empty())
+        return false;
+
+    char chunk[4096];
+    auto pos = buffer.find('\n');
+    while(pos == std::string::npos)
+    {
+        if(fd != -1 && !pollreadable(fd, deadline))
+            return false;
+        const auto n = fd == -1 ? 0 : ::read(fd, chunk, sizeof(chunk));
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n <= 0)
+        {
+            // Return the last unterminated line, if any, at the end of the stream
+            if(buffer.empty())
+                return false;
+            line = buffer;
+            buffer.clear();
+            return true;
+        }
+        buffer.append(chunk, static_cast<std::size_t>(n));
+        pos = buffer.find('\n');
+    }
+
+    line = buffer.substr(0, pos);
+    buffer.erase(0, pos + 1);
+    return true;
+}
+
+inline auto Process::read(ProcessPipe pipe, std::string& chunk, Deadline deadline) -> bool
+{
+    const auto fd = pipe == PipeOutput ? m_output : pipe == PipeError ? m_error : -1;
+    auto& buffer = pipe == PipeOutput ? m_outputbuf : m_errorbuf;
+
+    // Return the bytes buffered by previous calls first
+    if(!buffer.empty())
+    {
+        chunk.swap(buffer);
+        buffer.clear();
+        return true;
+    }
+
+    chunk.resize(1 << 16);
+    while(fd != -1 && pollreadable(fd, deadline))
+    {
+        const auto n = ::read(fd, &chunk[0], chunk.size());
+        if(n < 0 && errno == EINTR)
+            continue;
+        if(n <= 0)
+            break;
+        chunk.resize(static_cast<std::size_t>(n));
+        return true;
+    }
+    chunk.clear();
+    return false;
+}
+
+inline auto Process::closeinput() -> void
+{
+    closefd(m_input);
+}
+
+inline auto Process::limit(std::uint64_t cputime, std::uint64_t memory) -> bool
+{
+    if(m_pid == -1)
+        return false;
+#if defined(__linux__)
+    // The limits are applied right after the child process is spawned, since posix_spawn cannot set them
+    auto ok = true;
+    if(cputime > 0)
+    {
+        const rlimit cpu = { static_cast<rlim_t>(cputime), static_cast<rlim_t>(cputime + 1) }; // SIGXCPU first, then SIGKILL one second later
+        ok = prlimit(m_pid, RLIMIT_CPU, &cpu, nullptr) == 0 && ok;
+    }
+    if(memory > 0)
+    {
+        const rlimit as = { static_cast<rlim_t>(memory), static_cast<rlim_t>(memory) };
+        ok = prlimit(m_pid, RLIMIT_AS, &as, nullptr) == 0 && ok;
+    }
+    return ok;
+#else
+    return cputime == 0 && memory == 0;
+#endif
+}
+
+inline auto Process::waituntil(Deadline deadline) -> bool
+{
+    // Poll the child process with increasing delays, so that short runs are not delayed while long runs are not polled too often
+    auto delay = std::chrono::microseconds(50);
+    while(m_pid != -1 && !m_exited)
+    {
+        int status = 0;
+        const auto pid = waitpid(m_pid, &status, WNOHANG);
+        if(pid == -1 && errno == EINTR)
+            continue;
+        if(pid != 0)
+        {
+            m_exitcode = pid == m_pid && WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+            m_exited = true;
+            break;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if(now >= deadline)
+            return false;
+
+        // Buffer the standard error available so far, closing it at its end
+        readavailable(m_error, m_errorbuf);
+
+        std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(delay, deadline - now));
+        delay = std::min(2 * delay, std::chrono::microseconds(2000));
+    }
+    return true;
+}
+
+inline auto Process::kill() -> void
+{
+    if(m_pid != -1 && !m_exited)
+        ::kill(m_pid, SIGKILL);
+}
+
+inline auto Process::wait() -> int
+{
+    closefd(m_input);
+    closefd(m_output);
+    closefd(m_error);
+    m_outputbuf.clear();
+    m_errorbuf.clear();
+
+    if(m_pid == -1)
+        return -1;
+
+    auto exitcode = m_exitcode;
+    if(!m_exited)
+    {
+        int status = 0;
+        while(waitpid(m_pid, &status, 0) == -1 && errno == EINTR) {}
+        exitcode = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    }
+    m_pid = -1;
+    m_exitcode = -1;
+    m_exited = false;
+
+    return exitcode;
+}
+
+#else
+
+inline auto Process::start(const std::vector<std::string>&, int) -> bool { return false; }
+inline auto Process::write(const std::string&, Deadline) -> bool { return false; }
+inline auto Process::readline(ProcessPipe, std::string&, Deadline) -> bool { return false; }
+inline auto Process::read(ProcessPipe, std::string&, Deadline) -> bool { return false; }
+inline auto Process::closeinput() -> void {}
+inline auto Process::limit(std::uint64_t, std::uint64_t) -> bool { return false; }
+inline auto Process::waituntil(Deadline) -> bool { return true; }
+inline auto Process::kill() -> void {}
+inline auto Process::wait() -> int { return -1; }
+
+#endif
+
+} // namespace internal
+} // namespace sciplot
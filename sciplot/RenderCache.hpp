@@ -0,0 +1,203 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Utils.hpp>
+
+namespace sciplot {
+
+/// A directory of previously rendered plots and figures, which are reused instead of running gnuplot again.
+/// Each rendered file is stored under a key hashing the terminal settings, the script and the data of the plot or figure,
+/// so that saving an unchanged plot only copies (or hard links) the cached file. Set it with @ref Plot::renderCache or
+/// @ref Figure::renderCache. When the total size of the cached files exceeds the size limit, the least recently used are removed.
+/// The cache can be shared by many threads and processes. Errors of the file system are never thrown: they only cause cache misses.
+/// @note Data read by gnuplot from other files (e.g., with `plot.drawCurve("file.dat", 1, 2)`) is not part of the key.
+class RenderCache
+{
+  public:
+    /// Construct a RenderCache object using given directory (created if needed) and size limit in bytes (0 for no limit).
+    explicit RenderCache(std::string directory, std::uintmax_t maxsize = 0);
+
+    /// Toggle the use of hard links instead of copies for the files restored from the cache (disabled by default).
+    /// Hard links avoid copying, but restored files must then not be modified in place, since this would modify the cached files too.
+    auto hardLinks(bool enable = true) -> void { m_hardlinks = enable; }
+
+    /// Return the directory of the cached files.
+    auto directory() const -> const std::string& { return m_directory; }
+
+    /// Return the size limit of the cached files in bytes (0 for no limit).
+    auto maxSize() const -> std::uintmax_t { return m_maxsize; }
+
+    /// Restore the file cached under a key (if any) to a file with given name, marking it as recently used.
+    /// Return false if there is no such file in the cache, in which case an existing file with given name is left untouched.
+    auto fetch(std::uint64_t key, const std::string& filename) -> bool;
+
+    /// Unlink a file about to be rendered if hard links are enabled and it is a hard link (e.g., to a cached file restored by @ref fetch),
+    /// so that the render writes a new file instead of writing into the cached file.
+    auto detach(const std::string& filename) -> void;
+
+    /// Store a copy of a rendered file in the cache under a key, removing the least recently used files if the size limit is exceeded.
+    auto store(std::uint64_t key, const std::string& filename) -> void;
+
+  private:
+    /// Return the path of the file cached under a key, with the extension of the given file name.
+    auto path(std::uint64_t key, const std::string& filename) const -> std::filesystem::path;
+
+    /// Remove the least recently used files until the cached files fit in the size limit.
+    auto evict() -> void;
+
+    std::string m_directory;       ///< The directory of the cached files
+    std::uintmax_t m_maxsize = 0;  ///< The size limit of the cached files in bytes (0 for no limit)
+    bool m_hardlinks = false;      ///< Toggle the use of hard links for the files restored from the cache
+    std::mutex m_evictmutex;       ///< The mutex preventing concurrent evictions by the threads of this process
+};
+
+inline RenderCache::RenderCache(std::string directory, std::uintmax_t maxsize)
+: m_directory(std::move(directory)), m_maxsize(maxsize)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(m_directory, ec);
+}
+
+inline auto RenderCache::path(std::uint64_t key, const std::string& filename) const -> std::filesystem::path
+{
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key));
+    return std::filesystem::path(m_directory) / (name + std::filesystem::path(filename).extension().string());
+}
+
+inline auto RenderCache::fetch(std::uint64_t key, const std::string& filename) -> bool
+{
+    namespace fs = std::filesystem;
+    const auto cached = path(key, filename);
+    std::error_code ec;
+
+    if(!fs::exists(cached, ec))
+        return false;
+
+    // Remove the existing file only now that it is replaced, since a hard link cannot overwrite it
+    fs::remove(filename, ec);
+    ec.clear();
+    if(m_hardlinks)
+        fs::create_hard_link(cached, filename, ec);
+    if(!m_hardlinks || ec) // also copy if hard links are not supported (e.g., across file systems)
+    {
+        ec.clear();
+        fs::copy_file(cached, filename, fs::copy_options::overwrite_existing, ec);
+    }
+    if(ec)
+        return false; // e.g., the cached file was evicted in the meantime
+
+    // Mark the cached file as recently used
+    fs::last_write_time(cached, fs::file_time_type::clock::now(), ec);
+    return true;
+}
+
+inline auto RenderCache::detach(const std::string& filename) -> void
+{
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    if(m_hardlinks && fs::hard_link_count(filename, ec) > 1 && !ec)
+        fs::remove(filename, ec);
+}
+
+inline auto RenderCache::store(std::uint64_t key, const std::string& filename) -> void
+{
+    namespace fs = std::filesystem;
+    static std::atomic<std::size_t> counter{0};
+
+    // Copy the file to a temporary file renamed afterwards, so that other threads and processes never fetch a partial file
+    const auto cached = path(key, filename);
+    auto temporary = cached;
+    temporary += "." + internal::str(internal::processid()) + "-" + internal::str(counter++) + ".tmp";
+
+    std::error_code ec;
+    fs::copy_file(filename, temporary, fs::copy_options::overwrite_existing, ec);
+    if(!ec)
+        fs::rename(temporary, cached, ec);
+    if(ec)
+        fs::remove(temporary, ec);
+
+    if(m_maxsize > 0)
+        evict();
+}
+
+inline auto RenderCache::evict() -> void
+{
+    namespace fs = std::filesystem;
+    std::lock_guard<std::mutex> lock(m_evictmutex);
+
+    struct Entry
+    {
+        fs::path path;
+        fs::file_time_type time;
+        std::uintmax_t size;
+    };
+
+    // Collect the cached files (skipping the temporary ones being stored) and their total size
+    std::vector<Entry> entries;
+    std::uintmax_t total = 0;
+    std::error_code ec;
+    for(fs::directory_iterator it(m_directory, ec), end; !ec && it != end; it.increment(ec))
+    {
+        if(it->path().extension() == ".tmp")
+            continue;
+        std::error_code entryec;
+        const auto size = it->file_size(entryec);
+        const auto time = it->last_write_time(entryec);
+        if(entryec)
+            continue;
+        entries.push_back({ it->path(), time, size });
+        total += size;
+    }
+
+    if(total <= m_maxsize)
+        return;
+
+    // Remove the least recently used files first
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.time < b.time; });
+    for(const auto& entry : entries)
+    {
+        if(total <= m_maxsize)
+            break;
+        if(fs::remove(entry.path, ec))
+            total -= entry.size;
+    }
+}
+
+} // namespace sciplot
@@ -0,0 +1,68 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace sciplot {
+
+/// The limits of the gnuplot processes rendering a plot or a figure, set with @ref Plot::renderLimits or @ref Figure::renderLimits.
+/// A render exceeding its timeout is killed, its temporary files (if `autoclean` is enabled) and partial output file are removed,
+/// and @ref RenderTimeout is thrown. Exceeding a resource limit makes gnuplot fail, so that `save` returns false.
+/// @note The resource limits are only applied on Linux, right after gnuplot is spawned (it runs unlimited until then, before
+/// reading its script). Renders through a @ref GnuplotSession only apply the timeout, since the gnuplot process of a session is
+/// shared by many renders. Timeouts are not supported on Windows. Renders whose resource limits could not be applied still run,
+/// and report it in @ref RenderStats::limitsfailed.
+struct RenderLimits
+{
+    double timeout = 0.0;       ///< The maximum wall time of a render in seconds (0 for no limit)
+    std::uint64_t cputime = 0;  ///< The maximum CPU time of a gnuplot process in seconds (0 for no limit)
+    std::uint64_t memory = 0;   ///< The maximum address space of a gnuplot process in bytes (0 for no limit)
+};
+
+/// The exception thrown when a render exceeds the timeout set with @ref Plot::renderLimits or @ref Figure::renderLimits.
+class RenderTimeout : public std::runtime_error
+{
+  public:
+    /// Construct a RenderTimeout object for the render of a file with given name (empty for `show`).
+    explicit RenderTimeout(const std::string& filename)
+    : std::runtime_error(filename.empty() ? "The render was killed after exceeding its timeout."
+                                          : "The render of '" + filename + "' was killed after exceeding its timeout."),
+      m_filename(filename)
+    {
+    }
+
+    /// Return the name of the file whose render exceeded its timeout (empty for `show`).
+    auto filename() const -> const std::string& { return m_filename; }
+
+  private:
+    std::string m_filename; ///< The name of the file whose render exceeded its timeout
+};
+
+} // namespace sciplot
@@ -0,0 +1,160 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Figure.hpp>
+#include <sciplot/GnuplotSession.hpp>
+#include <sciplot/Plot.hpp>
+
+namespace sciplot {
+
+/// A pool of workers, each with its own gnuplot process (see @ref GnuplotSession), that save plots and figures in parallel.
+/// Every call to @ref save queues a copy of the plot or figure, made as in @ref Plot::saveAsync, and returns a future with the result of its render.
+/// A plot can thus be changed and queued again right away. When the queue is full, @ref save blocks until a worker takes the next job,
+/// which bounds the memory used by pending jobs.
+class RenderPool
+{
+  public:
+    /// Construct a RenderPool object with given number of workers and maximum number of pending jobs.
+    /// @param numworkers The number of workers (0 for the number of hardware threads).
+    /// @param maxpending The maximum number of jobs waiting for a worker (0 for twice the number of workers).
+    /// @param program The gnuplot executable run by each worker (searched in PATH).
+    explicit RenderPool(std::size_t numworkers = 0, std::size_t maxpending = 0, std::string program = "gnuplot");
+
+    /// Destroy this RenderPool object after all pending jobs have been rendered.
+    ~RenderPool();
+
+    RenderPool(const RenderPool&) = delete;
+    auto operator=(const RenderPool&) -> RenderPool& = delete;
+
+    /// Queue a copy of a plot to be saved in a file (see @ref Plot::save) and return the future result of its render.
+    auto save(const Plot& plot, std::string filename) -> std::future<bool>;
+
+    /// Queue a copy of a figure to be saved in a file (see @ref Figure::save) and return the future result of its render.
+    auto save(const Figure& figure, std::string filename) -> std::future<bool>;
+
+    /// Return the number of workers in the pool.
+    auto numWorkers() const -> std::size_t { return m_workers.size(); }
+
+  private:
+    /// Queue a job to be run by the next available worker, waiting while the queue is full.
+    auto submit(std::packaged_task<bool(GnuplotSession&)> job) -> std::future<bool>;
+
+    /// Run queued jobs in a worker thread, with a gnuplot session of its own, until the pool is destroyed.
+    /// The parallel work of each render (see @ref internal::parallelfor) is limited to @p maxthreads threads.
+    auto work(const std::string& program, std::size_t maxthreads) -> void;
+
+    std::vector<std::thread> m_workers;                            ///< The worker threads of the pool
+    std::deque<std::packaged_task<bool(GnuplotSession&)>> m_jobs;  ///< The jobs waiting for a worker
+    std::size_t m_maxpending = 0;                                  ///< The maximum number of jobs waiting for a worker
+    bool m_stopping = false;                                       ///< True once the pool is being destroyed
+    std::mutex m_mutex;                                            ///< The mutex protecting the queue of jobs
+    std::condition_variable m_jobqueued;                           ///< Notified when a job is queued or the pool is destroyed
+    std::condition_variable m_jobtaken;                            ///< Notified when a worker takes a job from the queue
+};
+
+inline RenderPool::RenderPool(std::size_t numworkers, std::size_t maxpending, std::string program)
+{
+    if(numworkers == 0)
+        numworkers = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    m_maxpending = maxpending == 0 ? 2 * numworkers : maxpending;
+
+    // Share the hardware threads among the workers, whose renders run concurrently
+    const auto maxthreads = std::max<std::size_t>(std::thread::hardware_concurrency() / numworkers, 1);
+    for(std::size_t i = 0; i < numworkers; ++i)
+        m_workers.emplace_back([this, program, maxthreads] { work(program, maxthreads); });
+}
+
+inline RenderPool::~RenderPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_jobqueued.notify_all();
+    for(auto& worker : m_workers)
+        worker.join();
+}
+
+inline auto RenderPool::save(const Plot& plot, std::string filename) -> std::future<bool>
+{
+    // Render a copy with temporary files of its own, since the plot may be changed and queued again before this job runs
+    return submit(std::packaged_task<bool(GnuplotSession&)>([plot = plot.snapshot(), filename](GnuplotSession& session) {
+        return plot.save(filename, session);
+    }));
+}
+
+inline auto RenderPool::save(const Figure& figure, std::string filename) -> std::future<bool>
+{
+    return submit(std::packaged_task<bool(GnuplotSession&)>([figure = figure.snapshot(), filename](GnuplotSession& session) {
+        return figure.save(filename, session);
+    }));
+}
+
+inline auto RenderPool::submit(std::packaged_task<bool(GnuplotSession&)> job) -> std::future<bool>
+{
+    auto result = job.get_future();
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_jobtaken.wait(lock, [&] { return m_jobs.size() < m_maxpending; });
+        m_jobs.push_back(std::move(job));
+    }
+    m_jobqueued.notify_one();
+    return result;
+}
+
+inline auto RenderPool::work(const std::string& program, std::size_t maxthreads) -> void
+{
+    internal::parallelmaxthreads = maxthreads;
+    GnuplotSession session(program);
+    while(true)
+    {
+        std::packaged_task<bool(GnuplotSession&)> job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_jobqueued.wait(lock, [&] { return m_stopping || !m_jobs.empty(); });
+            if(m_jobs.empty())
+                return;
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+        m_jobtaken.notify_one();
+        job(session); // exceptions thrown by the job are stored in its future
+    }
+}
+
+} // namespace sciplot
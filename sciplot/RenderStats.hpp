@@ -0,0 +1,92 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace sciplot {
+
+/// The wall time and byte counts of the phases of a render, reported by @ref Plot and @ref Figure to the callback set with
+/// @ref Plot::renderCallback or @ref Figure::renderCallback after every call to `save`, `show`, `render` and `savePlotData` / `saveplotdata`.
+/// All times are in seconds.
+struct RenderStats
+{
+    std::string operation;        ///< The operation that was timed ("save", "show", "render" or "saveplotdata")
+    std::string filename;         ///< The name of the saved file, or the names of the saved files separated by commas (empty unless the operation is "save")
+    bool success = false;         ///< True if the operation succeeded (for "show", if gnuplot was run successfully)
+    bool cached = false;          ///< True if the file was restored from the render cache instead of being rendered by gnuplot
+    bool timedout = false;        ///< True if gnuplot was killed after exceeding the timeout of the render (see @ref RenderLimits)
+    bool gnuplotmissing = false;  ///< True if gnuplot could not be started (e.g., because it is not installed or not in PATH)
+    bool limitsfailed = false;    ///< True if the resource limits of the render could not be applied to gnuplot (see @ref RenderLimits)
+    double cachetime = 0.0;       ///< The time spent computing render cache keys, restoring files from the cache and storing them in it
+    double scripttime = 0.0;      ///< The time spent generating the gnuplot script and writing it to its file (or a string for sessions)
+    double datatime = 0.0;        ///< The time spent serializing the data sets and writing them to the data files
+    double gnuplottime = 0.0;     ///< The time from starting gnuplot (or sending the script to a session) until it exited (or completed the script)
+    double cleanuptime = 0.0;     ///< The time spent removing the temporary files
+    double totaltime = 0.0;       ///< The total time of the operation
+    std::size_t scriptbytes = 0;  ///< The size of the gnuplot script in bytes
+    std::size_t databytes = 0;    ///< The size of the data written to the data files in bytes
+};
+
+/// The type of the functions called with the stats of every render (see @ref RenderStats).
+using RenderCallback = std::function<void(const RenderStats&)>;
+
+namespace internal {
+
+/// A stopwatch measuring the wall time of consecutive phases of an operation.
+class Stopwatch
+{
+  public:
+    /// Construct a Stopwatch object started at the current time.
+    Stopwatch() : m_start(clock::now()), m_lap(m_start) {}
+
+    /// Return the time in seconds since the previous lap (or the start), and start a new lap.
+    auto lap() -> double
+    {
+        const auto now = clock::now();
+        const auto seconds = std::chrono::duration<double>(now - m_lap).count();
+        m_lap = now;
+        return seconds;
+    }
+
+    /// Return the time in seconds since the start.
+    auto elapsed() const -> double
+    {
+        return std::chrono::duration<double>(clock::now() - m_start).count();
+    }
+
+  private:
+    using clock = std::chrono::steady_clock;
+    clock::time_point m_start; ///< The time at which the stopwatch was started
+    clock::time_point m_lap;   ///< The time at which the current lap was started
+};
+
+} // namespace internal
+} // namespace sciplot
@@ -0,0 +1,151 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/Process.hpp>
+#include <sciplot/RenderCache.hpp>
+#include <sciplot/RenderLimits.hpp>
+#include <sciplot/RenderStats.hpp>
+#include <sciplot/Utils.hpp>
+
+namespace sciplot {
+namespace internal {
+
+/// The steps of a render of a plot or a figure, run in order by @ref render. Plots and figures only provide the steps that
+/// differ between their renders (e.g., the script of `show` or the gnuplot process of a session), and @ref render times them,
+/// restores and stores the saved files in the render cache, removes the temporary files and reports the stats of the render.
+struct RenderSteps
+{
+    std::string operation;                                   ///< The operation of the render ("save", "show" or "render")
+    std::vector<std::string> filenames;                      ///< The files saved by the render (empty unless the operation is "save")
+    RenderCache* cache = nullptr;                            ///< The render cache of the saved files (null for none)
+    std::function<std::uint64_t(const std::string&)> cachekey; ///< Return the key of a saved file in the render cache
+    std::function<void()> preparedata;                       ///< Prepare the data sets before the script is written (optional, timed as data)
+    std::function<std::size_t(const std::vector<std::string>&)> writescript; ///< Write the script saving the given files (those not restored from the cache) and return its size in bytes
+    std::function<std::size_t()> writedata;                  ///< Write the data files and return their size in bytes
+    std::function<ProcessResult()> rungnuplot;               ///< Run gnuplot on the script
+    std::function<void()> cleanup;                           ///< Remove the temporary files (empty if autoclean is disabled)
+    RenderCallback callback;                                 ///< The function called with the stats of the render (optional)
+};
+
+/// Complete the stats of an operation timed with a stopwatch and pass them to a render callback (if any).
+/// @throws RenderTimeout if gnuplot exceeded its timeout, once the stats are reported.
+inline auto reportstats(RenderStats& stats, const Stopwatch& stopwatch, const RenderCallback& callback) -> void
+{
+    stats.totaltime = stopwatch.elapsed();
+    if(callback)
+        callback(stats);
+
+    // Report a timeout distinctly, once the temporary files are removed and the stats are reported
+    if(stats.timedout)
+        throw RenderTimeout(stats.filename);
+}
+
+/// Run the steps of a render and report its stats. Return true if gnuplot rendered successfully (or all files were restored from the cache).
+/// @throws RenderTimeout if gnuplot exceeded its timeout, once its partial outputs and temporary files are removed.
+inline auto render(const RenderSteps& steps) -> bool
+{
+    Stopwatch stopwatch;
+    RenderStats stats;
+    stats.operation = steps.operation;
+    for(const auto& filename : steps.filenames)
+        stats.filename += (stats.filename.empty() ? "" : ", ") + filename;
+
+    // Restore the files already saved with the same script and data from the render cache, and render only the others
+    std::vector<std::string> pending;
+    std::vector<std::uint64_t> keys;
+    for(const auto& filename : steps.filenames)
+    {
+        const auto key = steps.cache ? steps.cachekey(filename) : 0;
+        if(steps.cache && steps.cache->fetch(key, gnuplot::cleanpath(filename)))
+            continue;
+        pending.push_back(filename);
+        keys.push_back(key);
+    }
+    stats.cached = !steps.filenames.empty() && pending.empty();
+    stats.cachetime = stopwatch.lap();
+    if(steps.operation == "save" && pending.empty())
+    {
+        stats.success = true;
+        reportstats(stats, stopwatch, steps.callback);
+        return true;
+    }
+
+    // Prepare the data sets (e.g., deduplicate the data sets of the plots of a figure)
+    if(steps.preparedata)
+        steps.preparedata();
+    stats.datatime = stopwatch.lap();
+
+    // Write the script and the data files
+    stats.scriptbytes = steps.writescript(pending);
+    stats.scripttime = stopwatch.lap();
+    stats.databytes = steps.writedata();
+    stats.datatime += stopwatch.lap();
+
+    // Unlink the files to be rendered that were restored from the cache as hard links, which gnuplot must not write into
+    if(steps.cache)
+        for(const auto& filename : pending)
+            steps.cache->detach(gnuplot::cleanpath(filename));
+    stats.cachetime += stopwatch.lap();
+
+    // Run gnuplot on the script
+    const auto result = steps.rungnuplot();
+    stats.success = result.status == 0;
+    stats.timedout = result.timedout;
+    stats.gnuplotmissing = !result.started;
+    stats.limitsfailed = result.limitsfailed;
+    stats.gnuplottime = stopwatch.lap();
+
+    // Remove the partial outputs of a render killed after exceeding its timeout
+    if(stats.timedout)
+        for(const auto& filename : pending)
+            std::remove(gnuplot::cleanpath(filename).c_str());
+
+    // remove the temporary files if user wants to
+    if(steps.cleanup)
+        steps.cleanup();
+    stats.cleanuptime = stopwatch.lap();
+
+    // Store the saved files in the render cache
+    if(stats.success && steps.cache)
+        for(std::size_t i = 0; i < pending.size(); ++i)
+            steps.cache->store(keys[i], gnuplot::cleanpath(pending[i]));
+    stats.cachetime += stopwatch.lap();
+
+    reportstats(stats, stopwatch, steps.callback);
+    return stats.success;
+}
+
+} // namespace internal
+} // namespace sciplot
@@ -0,0 +1,143 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// sciplot includes
+#include <sciplot/ProcessId.hpp>
+
+namespace sciplot {
+namespace internal {
+
+/// A completed event of the trace of sciplot activity (see @ref enableTracing).
+struct TraceEvent
+{
+    const char* name;       ///< The name of the traced operation (e.g., "Plot::repr")
+    std::int64_t start;     ///< The time at which the operation started in nanoseconds
+    std::int64_t duration;  ///< The duration of the operation in nanoseconds
+    std::size_t thread;     ///< The sequential id of the thread that ran the operation
+};
+
+/// True if sciplot activity is being traced.
+inline std::atomic<bool> tracing{false};
+
+/// The mutex protecting the access to the trace events.
+inline std::mutex tracemutex;
+
+/// The trace events recorded since the last call to @ref saveTrace.
+inline std::vector<TraceEvent> traceevents;
+
+/// Return the current time of the trace clock in nanoseconds.
+inline auto tracetime() -> std::int64_t
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/// Return the sequential id of the calling thread in the trace (1 for the first thread that records an event, and so on).
+inline auto tracethread() -> std::size_t
+{
+    static std::atomic<std::size_t> counter{0};
+    thread_local const auto id = ++counter;
+    return id;
+}
+
+/// A scope of a traced operation, which records an event of its duration when it ends if tracing was enabled when it started.
+/// When tracing is disabled, a scope only costs the load of an atomic flag.
+class TraceScope
+{
+  public:
+    /// Construct a TraceScope object for an operation with given name, which must outlive the trace (e.g., a string literal).
+    explicit TraceScope(const char* name)
+    : m_name(name), m_start(tracing.load(std::memory_order_relaxed) ? tracetime() : -1)
+    {
+    }
+
+    /// Destroy this TraceScope object, recording the event of the operation if it is traced.
+    ~TraceScope()
+    {
+        if(m_start < 0)
+            return;
+        const TraceEvent event{ m_name, m_start, tracetime() - m_start, tracethread() };
+        std::lock_guard<std::mutex> lock(tracemutex);
+        traceevents.push_back(event);
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    auto operator=(const TraceScope&) -> TraceScope& = delete;
+
+  private:
+    const char* m_name;    ///< The name of the traced operation
+    std::int64_t m_start;  ///< The time at which the operation started in nanoseconds (negative if it is not traced)
+};
+
+} // namespace internal
+
+/// Toggle the tracing of sciplot activity (disabled by default), such as drawing data, generating scripts, saving data,
+/// running gnuplot and removing temporary files, in all threads. Call @ref saveTrace to write the recorded events to a file.
+inline auto enableTracing(bool enable = true) -> void
+{
+    internal::tracing = enable;
+}
+
+/// Write the trace events recorded so far to a file in the Chrome trace event format, which can be loaded into
+/// chrome://tracing or Perfetto, and discard them. Return false if the file could not be written.
+inline auto saveTrace(const std::string& filename) -> bool
+{
+    std::vector<internal::TraceEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(internal::tracemutex);
+        events.swap(internal::traceevents);
+    }
+
+    const auto pid = internal::processid();
+
+    std::ofstream file(filename);
+    file << "{\"traceEvents\":[";
+    char buffer[64];
+    for(std::size_t i = 0; i < events.size(); ++i)
+    {
+        const auto& event = events[i];
+        file << (i == 0 ? "\n" : ",\n");
+        file << "{\"name\":\"" << event.name << "\",\"cat\":\"sciplot\",\"ph\":\"X\"";
+        std::snprintf(buffer, sizeof(buffer), ",\"ts\":%.3f,\"dur\":%.3f", event.start / 1e3, event.duration / 1e3); // in microseconds
+        file << buffer << ",\"pid\":" << pid << ",\"tid\":" << event.thread << "}";
+    }
+    file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return static_cast<bool>(file);
+}
+
+} // namespace sciplot
@@ -27,29 +27,102 @@
 
 // C++ includes
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <charconv>
+#include <chrono>
+#include <clocale>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <exception>
 #include <fstream>
+#include <mutex>
 #include <sstream>
+#include <streambuf>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <type_traits>
 #include <valarray>
+#include <vector>
 
 // sciplot includes
 #include <sciplot/Constants.hpp>
+#include <sciplot/Default.hpp>
 #include <sciplot/Enums.hpp>
 #include <sciplot/Palettes.hpp>
+#include <sciplot/Process.hpp>
+#include <sciplot/ProcessId.hpp>
+#include <sciplot/Tracer.hpp>
 
 namespace sciplot {
 namespace internal {
 
+/// Check if type @p T is a number that is formatted as such (i.e., an arithmetic type other than `bool` and character types).
+template <typename T>
+constexpr auto isNumber = std::is_arithmetic_v<T>
+    && !std::is_same_v<T, bool>
+    && !std::is_same_v<T, char>
+    && !std::is_same_v<T, signed char>
+    && !std::is_same_v<T, unsigned char>
+    && !std::is_same_v<T, wchar_t>
+    && !std::is_same_v<T, char16_t>
+    && !std::is_same_v<T, char32_t>;
+
+/// The maximum number of characters needed by @ref tochars to format a number.
+constexpr auto MAX_NUMBER_CHARS = 64;
+
+/// Write the shortest text representation of floating point number @p val that reads back to the same value in the range [first, last)
+/// with snprintf, trying increasing precisions until the value round-trips (see @ref tochars). Returns the pointer past the last written character.
+/// The decimal point is always '.', whatever the current C locale (gnuplot scripts and data files are not localized).
+template <typename T>
+auto printfchars(char* first, char* last, T val) -> char*
+{
+    const auto maxprecision = std::is_same_v<T, float> ? 9 : 17;
+    auto precision = std::is_same_v<T, float> ? 6 : 15;
+    auto count = std::snprintf(first, last - first, "%.*Lg", precision, static_cast<long double>(val));
+    while(precision < maxprecision && static_cast<T>(std::strtold(first, nullptr)) != val) // strtold reads the decimal point of the locale too
+        count = std::snprintf(first, last - first, "%.*Lg", ++precision, static_cast<long double>(val));
+
+    // Replace the decimal point of the current locale (e.g., ',' in German locales) by the one of the C locale
+    const auto point = *std::localeconv()->decimal_point;
+    if(point != '.')
+        std::replace(first, first + count, point, '.');
+    return first + count;
+}
+
+/// Write the shortest text representation of number @p val that reads back to the same value in the range [first, last).
+/// Returns the pointer past the last written character. The range must have at least @ref MAX_NUMBER_CHARS characters.
+template <typename T>
+auto tochars(char* first, char* last, T val) -> char*
+{
+#if !defined(__cpp_lib_to_chars)
+    // Fallback for standard libraries without floating point std::to_chars
+    if constexpr(std::is_floating_point_v<T>)
+        return printfchars(first, last, val);
+    else
+#endif
+    return std::to_chars(first, last, val).ptr;
+}
+
 /// Return a string for a given value of a generic type.
 template <typename T>
 auto str(const T& val) -> std::string
 {
-    std::stringstream ss;
-    ss << val;
-    return ss.str(); // Note: This is different than std::to_string(i). For example, it works with custom types. Also, std::to_string(2.0) may produce "2.000000", difficulting string comparison in the tests.
+    if constexpr(isNumber<T>)
+    {
+        char chars[MAX_NUMBER_CHARS];
+        return std::string(chars, tochars(chars, chars + MAX_NUMBER_CHARS, val)); // Note: unlike std::to_string(2.0), which produces "2.000000", this produces "2" (the shortest string that reads back to the same value).
+    }
+    else
+    {
+        std::stringstream ss;
+        ss << val;
+        return ss.str(); // Note: This is different than std::to_string(i). For example, it works with custom types.
+    }
 }
 
 /// Return a string for a given char array
@@ -83,7 +156,7 @@ inline auto trimright(std::string str, unsigned char character=' ') -> std::stri
 /// Trim the string from both ends
 inline auto trim(std::string str, unsigned char character=' ') -> std::string
 {
-    return trimleft(trimright(str, character), character);
+    return trimleft(trimright(std::move(str), character), character);
 }
 
 /// Remove extra spaces from a string (e.g., `"abc  acb   xy s "` becomes `"abc acb xy s "`).
@@ -98,9 +171,131 @@ inline auto collapseWhitespaces(std::string s) -> std::string
 /// Trim and collapse all spaces in a string (e.g., `"  abc  acb   xy s "` becomes `"abc acb xy s"`).
 inline auto removeExtraWhitespaces(std::string s) -> std::string
 {
-    return trim(collapseWhitespaces(s));
+    return trim(collapseWhitespaces(std::move(s)));
 }
 
+/// An append-only buffer in which gnuplot scripts and command strings are built with a single growing allocation.
+/// It replaces string streams in the string representations of specs and plots, which allocate on construction,
+/// format numbers through locales and copy their contents on return. Reserve the expected size on construction to
+/// avoid reallocations, and move the result out with @ref release.
+class ScriptBuilder
+{
+  public:
+    /// Construct a ScriptBuilder object with given reserved capacity in bytes.
+    explicit ScriptBuilder(std::size_t capacity = 0) { m_script.reserve(capacity); }
+
+    /// Append a character.
+    auto operator<<(char ch) -> ScriptBuilder&
+    {
+        m_script.push_back(ch);
+        return *this;
+    }
+
+    /// Append a string (or anything convertible to a string view), or the shortest representation of a number (see @ref tochars).
+    template <typename T, std::enable_if_t<isNumber<T> || std::is_convertible_v<const T&, std::string_view>, int> = 0>
+    auto operator<<(const T& val) -> ScriptBuilder&
+    {
+        if constexpr(isNumber<T>)
+        {
+            char chars[MAX_NUMBER_CHARS];
+            m_script.append(chars, tochars(chars, chars + MAX_NUMBER_CHARS, val));
+        }
+        else m_script.append(std::string_view(val));
+        return *this;
+    }
+
+    /// Append a `option value` pair followed by a space, or nothing if the value is empty (see @ref gnuplot::optionValueStr).
+    auto option(std::string_view option, std::string_view value) -> ScriptBuilder&
+    {
+        if(value.size())
+            *this << option << ' ' << value << ' ';
+        return *this;
+    }
+
+    /// Append a `command value` pair followed by a line break, or nothing if the value is empty (see @ref gnuplot::commandValueStr).
+    auto command(std::string_view cmd, std::string_view value) -> ScriptBuilder&
+    {
+        if(value.size())
+            *this << cmd << ' ' << value << '\n';
+        return *this;
+    }
+
+    /// Trim and collapse all spaces in the buffer, in place (see @ref removeExtraWhitespaces).
+    auto compact() -> ScriptBuilder&
+    {
+        m_script.erase(std::unique(m_script.begin(), m_script.end(),
+            [](unsigned char a, unsigned char b) { return std::isspace(a) && std::isspace(b); }), m_script.end());
+        if(m_script.size() && m_script.back() == ' ')
+            m_script.pop_back();
+        if(m_script.size() && m_script.front() == ' ')
+            m_script.erase(0, 1);
+        return *this;
+    }
+
+    /// Return the size of the buffer in bytes.
+    auto size() const -> std::size_t { return m_script.size(); }
+
+    /// Return a view of the buffer.
+    auto view() const -> std::string_view { return m_script; }
+
+    /// Move the buffer out of this object, which is left empty.
+    auto release() -> std::string { return std::move(m_script); }
+
+  private:
+    std::string m_script; ///< The buffer in which the script is built
+};
+
+/// A stream buffer appending to a @ref ScriptBuilder object, used where a standard output stream is needed (e.g., to write data blocks).
+class ScriptBuilderBuffer : public std::streambuf
+{
+  public:
+    /// Construct a ScriptBuilderBuffer object appending to a given ScriptBuilder object.
+    explicit ScriptBuilderBuffer(ScriptBuilder& builder) : m_builder(builder) {}
+
+  protected:
+    auto overflow(int_type ch) -> int_type override
+    {
+        if(!traits_type::eq_int_type(ch, traits_type::eof()))
+            m_builder << traits_type::to_char_type(ch);
+        return traits_type::not_eof(ch);
+    }
+
+    auto xsputn(const char* chars, std::streamsize count) -> std::streamsize override
+    {
+        m_builder << std::string_view(chars, static_cast<std::size_t>(count));
+        return count;
+    }
+
+  private:
+    ScriptBuilder& m_builder; ///< The ScriptBuilder object appended to
+};
+
+/// A stream buffer appending to a vector of bytes (e.g., to collect the output of gnuplot in @ref Plot::render).
+class ByteVectorBuffer : public std::streambuf
+{
+  public:
+    /// Construct a ByteVectorBuffer object appending to a given vector of bytes.
+    explicit ByteVectorBuffer(std::vector<std::byte>& bytes) : m_bytes(bytes) {}
+
+  protected:
+    auto overflow(int_type ch) -> int_type override
+    {
+        if(!traits_type::eq_int_type(ch, traits_type::eof()))
+            m_bytes.push_back(static_cast<std::byte>(traits_type::to_char_type(ch)));
+        return traits_type::not_eof(ch);
+    }
+
+    auto xsputn(const char* chars, std::streamsize count) -> std::streamsize override
+    {
+        const auto bytes = reinterpret_cast<const std::byte*>(chars);
+        m_bytes.insert(m_bytes.end(), bytes, bytes + count);
+        return count;
+    }
+
+  private:
+    std::vector<std::byte>& m_bytes; ///< The vector of bytes appended to
+};
+
 /// Auxiliary function that returns the size of the vector argument with least size (for a single vector case)
 template <typename VectorType>
 auto minsize(const VectorType& v) -> std::size_t
@@ -123,6 +318,10 @@ constexpr auto isString = std::is_same_v<std::decay_t<T>, std::string>;
 template <typename V>
 constexpr auto isStringVector = isString<decltype(std::declval<V>()[0])>;
 
+/// Check if type @p V is a vector of numbers (e.g., `std::vector<int>`, `std::valarray<double>`).
+template <typename V>
+constexpr auto isNumberVector = std::is_arithmetic_v<std::decay_t<decltype(std::declval<V>()[0])>>;
+
 /// Auxiliary function that returns `" + val + "` if `val` is string, otherwise `val` itself.
 template <typename T>
 auto escapeIfNeeded(const T& val)
@@ -132,31 +331,277 @@ auto escapeIfNeeded(const T& val)
     else return val;
 }
 
-/// Auxiliary function to write many vector arguments into a line of an ostream object
+/// Auxiliary function to append the text of a value to a character buffer (numbers with shortest round-trip precision, strings with quotes).
+template <typename T>
+auto appendvalue(std::string& buffer, const T& val) -> void
+{
+    if constexpr(isNumber<T>)
+    {
+        char chars[MAX_NUMBER_CHARS];
+        buffer.append(chars, tochars(chars, chars + MAX_NUMBER_CHARS, val));
+    }
+    else if constexpr(isString<T>)
+    {
+        buffer += '"';
+        buffer += val;
+        buffer += '"';
+    }
+    else buffer += str(val);
+}
+
+/// Auxiliary function to append many vector arguments as a line of text to a character buffer
 template <typename VectorType>
-auto writeline(std::ostream& out, std::size_t i, const VectorType& v) -> std::ostream&
+auto appendline(std::string& buffer, std::size_t i, const VectorType& v) -> void
 {
-    out << escapeIfNeeded(v[i]) << '\n';
-    return out;
+    appendvalue(buffer, v[i]);
+    buffer += '\n';
+}
+
+/// Auxiliary function to append many vector arguments as a line of text to a character buffer
+template <typename VectorType, typename... Args>
+auto appendline(std::string& buffer, std::size_t i, const VectorType& v, const Args&... args) -> void
+{
+    appendvalue(buffer, v[i]);
+    buffer += ' ';
+    appendline(buffer, i, args...);
 }
 
 /// Auxiliary function to write many vector arguments into a line of an ostream object
 template <typename VectorType, typename... Args>
 auto writeline(std::ostream& out, std::size_t i, const VectorType& v, const Args&... args) -> std::ostream&
 {
-    out << escapeIfNeeded(v[i]) << " ";
-    writeline(out, i, args...);
-    return out;
+    std::string buffer;
+    appendline(buffer, i, v, args...);
+    return out.write(buffer.data(), buffer.size());
+}
+
+/// Auxiliary function to stream rows into an ostream object through a reusable buffer of fixed size.
+/// The rows are appended to the buffer with `appendrow(buffer, i)`, and the buffer is written out whenever it gets full,
+/// so that no more than @ref DEFAULT_DATA_BUFFER_SIZE bytes (plus one row) are kept in memory, regardless of the number of rows.
+template <typename AppendRowFunction>
+auto writerows(std::ostream& out, std::size_t numrows, const AppendRowFunction& appendrow) -> std::ostream&
+{
+    std::string buffer;
+    buffer.reserve(DEFAULT_DATA_BUFFER_SIZE + MAX_NUMBER_CHARS);
+    for (std::size_t i = 0; i < numrows; ++i)
+    {
+        appendrow(buffer, i);
+        if(buffer.size() >= DEFAULT_DATA_BUFFER_SIZE)
+        {
+            out.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+    return out.write(buffer.data(), buffer.size());
 }
 
 /// Auxiliary function to write many vector arguments into an ostream object
 template <typename... Args>
 auto write(std::ostream& out, const Args&... args) -> std::ostream&
 {
-    const auto size = minsize(args...);
-    for (std::size_t i = 0; i < size; ++i)
-        writeline(out, i, args...);
-    return out;
+    return writerows(out, minsize(args...), [&](std::string& buffer, std::size_t i) { appendline(buffer, i, args...); });
+}
+
+/// Check if the machine stores numbers in little-endian byte order.
+inline auto islittleendian() -> bool
+{
+    const std::uint16_t one = 1;
+    unsigned char byte = 0;
+    std::memcpy(&byte, &one, 1);
+    return byte == 1;
+}
+
+/// Return the gnuplot binary format of the entries in vector type @p V (`%float` for floats, `%double` otherwise).
+template <typename V>
+auto binaryformat() -> std::string
+{
+    return std::is_same_v<std::decay_t<decltype(std::declval<V>()[0])>, float> ? "%float" : "%double";
+}
+
+/// Auxiliary function to append a number as raw little-endian bytes to a byte buffer (floats are kept as floats, everything else is written as double).
+template <typename T>
+auto appendbinaryvalue(std::string& buffer, const T& val) -> void
+{
+    using U = std::conditional_t<std::is_same_v<T, float>, float, double>;
+    const U number = static_cast<U>(val);
+    char bytes[sizeof(U)];
+    std::memcpy(bytes, &number, sizeof(U));
+    if(!islittleendian())
+        std::reverse(bytes, bytes + sizeof(U));
+    buffer.append(bytes, sizeof(U));
+}
+
+/// Auxiliary function to append many vector arguments as a binary record to a byte buffer
+template <typename VectorType>
+auto appendbinaryline(std::string& buffer, std::size_t i, const VectorType& v) -> void
+{
+    appendbinaryvalue(buffer, v[i]);
+}
+
+/// Auxiliary function to append many vector arguments as a binary record to a byte buffer
+template <typename VectorType, typename... Args>
+auto appendbinaryline(std::string& buffer, std::size_t i, const VectorType& v, const Args&... args) -> void
+{
+    appendbinaryvalue(buffer, v[i]);
+    appendbinaryline(buffer, i, args...);
+}
+
+/// Auxiliary function to write many vector arguments into an ostream object as interleaved binary records
+template <typename... Args>
+auto writebinary(std::ostream& out, const Args&... args) -> std::ostream&
+{
+    return writerows(out, minsize(args...), [&](std::string& buffer, std::size_t i) { appendbinaryline(buffer, i, args...); });
+}
+
+/// The offset basis of the 64-bit FNV-1a hash function.
+constexpr std::uint64_t FNV1A_OFFSET_BASIS = 14695981039346656037ULL;
+
+/// The prime of the 64-bit FNV-1a hash function.
+constexpr std::uint64_t FNV1A_PRIME = 1099511628211ULL;
+
+/// Return the 64-bit FNV-1a hash of given bytes, continuing from a previous hash value.
+inline auto fnv1a(const char* data, std::size_t size, std::uint64_t hash = FNV1A_OFFSET_BASIS) -> std::uint64_t
+{
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= FNV1A_PRIME;
+    }
+    return hash;
+}
+
+/// Return the 64-bit FNV-1a hash of a string, continuing from a previous hash value.
+inline auto fnv1a(const std::string& text, std::uint64_t hash = FNV1A_OFFSET_BASIS) -> std::uint64_t
+{
+    return fnv1a(text.data(), text.size(), hash);
+}
+
+/// Return the hash value resulting from combining a hash value with another one.
+inline auto hashcombine(std::uint64_t hash, std::uint64_t value) -> std::uint64_t
+{
+    char bytes[sizeof(value)];
+    std::memcpy(bytes, &value, sizeof(value));
+    return fnv1a(bytes, sizeof(bytes), hash);
+}
+
+/// A stream buffer that hashes the bytes written into it (with the FNV-1a hash function) instead of storing them.
+class HashBuffer : public std::streambuf
+{
+  public:
+    /// Return the hash of the bytes written so far.
+    auto hash() const -> std::uint64_t { return m_hash; }
+
+  protected:
+    auto overflow(int ch) -> int override
+    {
+        if(ch != traits_type::eof())
+        {
+            const auto c = static_cast<char>(ch);
+            m_hash = fnv1a(&c, 1, m_hash);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    auto xsputn(const char* s, std::streamsize n) -> std::streamsize override
+    {
+        m_hash = fnv1a(s, static_cast<std::size_t>(n), m_hash);
+        return n;
+    }
+
+  private:
+    std::uint64_t m_hash = FNV1A_OFFSET_BASIS; ///< The hash of the bytes written so far
+};
+
+/// Replace all occurrences of a non-empty substring in a string.
+inline auto replaceall(std::string str, const std::string& from, const std::string& to) -> std::string
+{
+    for(auto pos = str.find(from); pos != std::string::npos; pos = str.find(from, pos + to.size()))
+        str.replace(pos, from.size(), to);
+    return str;
+}
+
+/// The directory where temporary script and data files are created (empty for the current working directory).
+inline std::string scratchdir;
+
+/// The mutex protecting the access to the scratch directory.
+inline std::mutex scratchdirmutex;
+
+} // namespace internal
+
+/// Set the directory where plots and figures constructed afterwards create their temporary script and data files.
+/// By default, they are created in the current working directory. A RAM-backed directory (e.g., `/dev/shm`) avoids disk I/O.
+/// @note The directory must exist, and its path must not contain single quotes (it is quoted in gnuplot scripts).
+inline auto scratchDirectory(std::string path) -> void
+{
+    std::lock_guard<std::mutex> lock(internal::scratchdirmutex);
+    internal::scratchdir = std::move(path);
+}
+
+/// Return the directory where plots and figures create their temporary script and data files (empty for the current working directory).
+inline auto scratchDirectory() -> std::string
+{
+    std::lock_guard<std::mutex> lock(internal::scratchdirmutex);
+    return internal::scratchdir;
+}
+
+namespace internal {
+
+/// Return the path of a temporary file in the scratch directory, whose name contains the process id so that processes sharing the directory do not collide (e.g., `/dev/shm/plot1234-0.dat`).
+inline auto scratchfilename(const std::string& name, std::size_t id, const std::string& extension) -> std::string
+{
+    auto path = scratchDirectory();
+    if(!path.empty() && path.back() != '/' && path.back() != '\\')
+        path += '/';
+    return path + name + str(processid()) + "-" + str(id) + extension;
+}
+
+/// The minimum amount of work (e.g., the number of data values read or written) of a call to @ref parallelfor for it to be split among threads.
+/// Below it, starting the threads costs more than they save, and all calls are made by the calling thread.
+constexpr std::size_t PARALLEL_MIN_WORK = std::size_t(1) << 16;
+
+/// The maximum number of threads used by the parallel work of the current thread (0 for one per hardware thread).
+/// The workers of a @ref RenderPool set it, so that their concurrent renders share the hardware threads instead of each using all of them.
+inline thread_local std::size_t parallelmaxthreads = 0;
+
+/// Return the number of threads to be used by the parallel work of the current thread (see @ref parallelmaxthreads).
+inline auto parallelthreads() -> std::size_t
+{
+    const auto numthreads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    return parallelmaxthreads == 0 ? numthreads : std::min(parallelmaxthreads, numthreads);
+}
+
+/// Call a function with each index in [0, n) using up to @ref parallelthreads threads, waiting for all calls to complete.
+/// The calls are only split among threads if their total amount of @p work reaches @ref PARALLEL_MIN_WORK.
+/// The calling thread takes part in the work. The first exception thrown by a call is rethrown after all calls have completed.
+template <typename Function>
+auto parallelfor(std::size_t n, std::size_t work, const Function& function) -> void
+{
+    const auto numthreads = work < PARALLEL_MIN_WORK ? 1 : std::min(parallelthreads(), n);
+
+    std::atomic<std::size_t> next{0};
+    std::exception_ptr error;
+    std::mutex errormutex;
+    auto run = [&] {
+        for(auto i = next++; i < n; i = next++)
+        {
+            try { function(i); }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(errormutex);
+                if(!error) error = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(std::size_t i = 1; i < numthreads; ++i)
+        threads.emplace_back(run);
+    run();
+    for(auto& thread : threads)
+        thread.join();
+
+    if(error)
+        std::rethrow_exception(error);
 }
 
 } // namespace internal
@@ -234,6 +679,23 @@ auto writedataset(std::ostream& out, std::size_t index, const Args&... args) ->
     return out;
 }
 
+/// Auxiliary function to create a binary data set in an ostream object (raw little-endian records without any header)
+template <typename... Args>
+auto writebinarydataset(std::ostream& out, const Args&... args) -> std::ostream&
+{
+    return internal::writebinary(out, args...);
+}
+
+/// Return the formatted string for a binary data set in a file (e.g., "'plot0.bin' binary record=100 format="%double%double" endian=little skip=0").
+/// @param filename The name of the binary data file
+/// @param offset The number of bytes preceding the data set in the file
+/// @param records The number of records (rows) in the data set
+/// @param format The format of each record (e.g., "%double%double")
+inline auto binarydatasetstr(std::string filename, std::size_t offset, std::size_t records, std::string format) -> std::string
+{
+    return "'" + filename + "' binary record=" + internal::str(records) + " format=\"" + format + "\" endian=little skip=" + internal::str(offset);
+}
+
 /// Auxiliary function to write palette data for a selected palette ot start of plot script
 inline auto palettecmd(std::ostream& out, std::string palette) -> std::ostream&
 {
@@ -242,7 +704,7 @@ inline auto palettecmd(std::ostream& out, std::string palette) -> std::ostream&
     out << "#------------------------------------------------------------------------------" << std::endl;
     out << "# see more at https://github.com/Gnuplotting/gnuplot-palettes" << std::endl;
     out << "#==============================================================================" << std::endl;
-    out << palettes.at(palette) << std::endl;
+    out << palettecommands(palette) << std::endl;
     return out;
 }
 
@@ -273,13 +735,15 @@ inline auto saveterminalcmd(std::ostream& out, std::string extension, std::strin
     return out;
 }
 
-/// Auxiliary function to set the output command to make GNUplot output plots to a file
+/// Auxiliary function to set the output command to make GNUplot output plots to a file (or to its standard output if the file name is empty)
 inline auto outputcmd(std::ostream& out, std::string filename) -> std::ostream&
 {
     out << "#==============================================================================" << std::endl;
     out << "# OUTPUT" << std::endl;
     out << "#==============================================================================" << std::endl;
-    out << "set output '" << filename << "'" << std::endl;
+    if(filename.empty())
+        out << "set output" << std::endl;
+    else out << "set output '" << filename << "'" << std::endl;
     return out;
 }
 
@@ -304,14 +768,70 @@ inline auto multiplotcmd(std::ostream& out, std::size_t rows, std::size_t column
     return out;
 }
 
-/// Auxiliary function to run gnuplot to show or save a script file
+/// Auxiliary function to run gnuplot to show or save a script file within given limits (see @ref RenderLimits)
 // persistent == true: for show commands. show the file using GNUplot until the window is closed
 // persistent == false: for save commands. close gnuplot immediately
-inline auto runscript(std::string scriptfilename, bool persistent) -> bool
+// On POSIX systems, gnuplot is spawned directly (without a shell), so the script file name needs no quoting
+inline auto runscript(const std::string& scriptfilename, bool persistent, const RenderLimits& limits) -> internal::ProcessResult
 {
+    internal::TraceScope trace("gnuplot::runscript");
+#if defined(_WIN32)
     std::string command = persistent ? "gnuplot -persistent " : "gnuplot ";
     command += "\"" + scriptfilename + "\"";
-    return std::system(command.c_str()) == 0;
+    internal::ProcessResult result;
+    result.started = true;
+    result.limitsfailed = limits.cputime > 0 || limits.memory > 0;
+    result.status = std::system(command.c_str());
+    return result;
+#else
+    std::vector<std::string> args = { "gnuplot" };
+    if(persistent)
+        args.push_back("-persistent");
+    args.push_back(scriptfilename);
+    return internal::runprocess(args, false, limits);
+#endif
+}
+
+/// Auxiliary function to run gnuplot on a script file that renders to its standard output (see @ref outputcmd), within given limits
+/// (see @ref RenderLimits). The output is forwarded to an ostream object as gnuplot produces it, without any output file.
+/// @note This is only supported on POSIX systems (gnuplot is never started on Windows).
+inline auto runscript(const std::string& scriptfilename, std::ostream& output, const RenderLimits& limits) -> internal::ProcessResult
+{
+    internal::TraceScope trace("gnuplot::runscript");
+    internal::ProcessResult result;
+    internal::Process process;
+    result.started = process.start({ "gnuplot", scriptfilename }, internal::PipeOutput);
+    if(!result.started)
+        return result;
+    result.limitsfailed = !process.limit(limits.cputime, limits.memory);
+
+    const auto deadline = internal::deadlineafter(limits.timeout);
+    std::string chunk;
+    while(process.read(internal::PipeOutput, chunk, deadline))
+        output.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+
+    // Kill gnuplot if it is still running after the deadline
+    if(std::chrono::steady_clock::now() >= deadline)
+    {
+        process.kill();
+        result.timedout = true;
+    }
+    result.status = process.wait();
+    return result;
+}
+
+/// Auxiliary function to run gnuplot to show or save a script file
+// persistent == true: for show commands. show the file using GNUplot until the window is closed
+// persistent == false: for save commands. close gnuplot immediately
+inline auto runscript(std::string scriptfilename, bool persistent) -> bool
+{
+    return runscript(scriptfilename, persistent, RenderLimits{}).status == 0;
+}
+
+/// Return the file format given by the extension of a file name (e.g., "pdf" for "plot.pdf").
+inline auto fileformat(const std::string& filename) -> std::string
+{
+    return filename.substr(filename.rfind(".") + 1);
 }
 
 /// Auxiliary function to escape a output path so it can be used for GNUplot.
@@ -28,7 +28,10 @@
 // C++ includes
 #include <algorithm>
 #include <functional>
+#include <iterator>
+#include <memory>
 #include <string>
+#include <type_traits>
 #include <valarray>
 #include <vector>
 
@@ -61,4 +64,50 @@ auto range(int x0, int x1) -> Vec
     return result;
 }
 
+/// A lightweight view of a vector, used to draw its data without copying it (e.g., `plot.drawCurve(view(x), view(y))`).
+/// The entries of the vector are only read when the plot data is saved (e.g., in `Plot::save` and `Plot::show`).
+/// A view constructed from a reference does not own the vector, which must outlive (and keep its size during) these calls.
+/// A view constructed from a `std::shared_ptr` shares the ownership of the vector.
+template <typename V>
+class VecView
+{
+  public:
+    /// Construct a VecView object that refers to a given vector without owning it.
+    explicit VecView(const V& vec) : m_vec(&vec) {}
+
+    /// Construct a VecView object that shares the ownership of a given vector.
+    explicit VecView(std::shared_ptr<const V> vec) : m_owner(std::move(vec)), m_vec(m_owner.get()) {}
+
+    /// Return the size of the viewed vector.
+    auto size() const -> std::size_t { return std::size(*m_vec); }
+
+    /// Return the entry of the viewed vector with given index.
+    auto operator[](std::size_t i) const -> decltype(auto) { return (*m_vec)[i]; }
+
+  private:
+    /// The owner of the viewed vector (empty if the view does not own it).
+    std::shared_ptr<const V> m_owner;
+
+    /// The viewed vector.
+    const V* m_vec = nullptr;
+};
+
+/// Return a view of a vector that does not own it (see @ref VecView).
+template <typename V>
+auto view(const V& vec) -> VecView<V>
+{
+    return VecView<V>(vec);
+}
+
+/// Return a view of a vector that shares its ownership (see @ref VecView).
+template <typename V>
+auto view(std::shared_ptr<V> vec) -> VecView<std::remove_const_t<V>>
+{
+    return VecView<std::remove_const_t<V>>(std::move(vec));
+}
+
+/// Prevent views of temporary vectors, which would be destroyed before the plot data is saved.
+template <typename V>
+auto view(const V&& vec) -> VecView<V> = delete;
+
 } // namespace sciplot
@@ -27,11 +27,22 @@
 
 // sciplot includes
 #include <sciplot/Constants.hpp>
+#include <sciplot/DataSet.hpp>
 #include <sciplot/Default.hpp>
+#include <sciplot/Downsampling.hpp>
 #include <sciplot/Enums.hpp>
 #include <sciplot/Figure.hpp>
+#include <sciplot/GnuplotSession.hpp>
 #include <sciplot/Palettes.hpp>
 #include <sciplot/Plot.hpp>
+#include <sciplot/Process.hpp>
+#include <sciplot/ProcessId.hpp>
+#include <sciplot/RenderCache.hpp>
+#include <sciplot/RenderLimits.hpp>
+#include <sciplot/RenderPool.hpp>
+#include <sciplot/RenderStats.hpp>
+#include <sciplot/RenderSteps.hpp>
 #include <sciplot/StringOrDouble.hpp>
+#include <sciplot/Tracer.hpp>
 #include <sciplot/Utils.hpp>
 #include <sciplot/Vec.hpp>
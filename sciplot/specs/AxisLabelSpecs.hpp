@@ -73,24 +73,28 @@ inline AxisLabelSpecs::AxisLabelSpecs(std::string axis)
 inline auto AxisLabelSpecs::text(std::string text) -> AxisLabelSpecs&
 {
     m_text = "'" + text + "'";
+    changed();
     return *this;
 }
 
 inline auto AxisLabelSpecs::rotateBy(int degrees) -> AxisLabelSpecs&
 {
     m_rotate = "rotate by " + std::to_string(degrees);
+    changed();
     return *this;
 }
 
 inline auto AxisLabelSpecs::rotateAxisParallel() -> AxisLabelSpecs&
 {
     m_rotate = "rotate parallel";
+    changed();
     return *this;
 }
 
 inline auto AxisLabelSpecs::rotateNone() -> AxisLabelSpecs&
 {
     m_rotate = "norotate";
+    changed();
     return *this;
 }
 
@@ -99,12 +103,12 @@ inline auto AxisLabelSpecs::repr() const -> std::string
     if(m_text.empty() && m_rotate.empty())
         return "";
 
-    std::stringstream ss;
-    ss << "set " + m_axis + "label ";
+    internal::ScriptBuilder ss;
+    ss << "set " << m_axis << "label ";
     ss << m_text << " ";
-    ss << TextSpecsOf<AxisLabelSpecs>::repr() + " ";
-    ss << gnuplot::optionStr(m_rotate);
-    return internal::removeExtraWhitespaces(ss.str());
+    ss << TextSpecsOf<AxisLabelSpecs>::repr() << " ";
+    ss << m_rotate;
+    return ss.compact().release();
 }
 
 } // namespace sciplot
@@ -124,6 +124,7 @@ inline BorderSpecs::BorderSpecs()
 inline auto BorderSpecs::clear() -> BorderSpecs&
 {
     m_encoding.reset();
+    changed();
     return *this;
 }
 
@@ -135,112 +136,129 @@ inline auto BorderSpecs::none() -> BorderSpecs&
 inline auto BorderSpecs::bottom() -> BorderSpecs&
 {
     m_encoding.set(0);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::left() -> BorderSpecs&
 {
     m_encoding.set(1);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::top() -> BorderSpecs&
 {
     m_encoding.set(2);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::right() -> BorderSpecs&
 {
     m_encoding.set(3);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::bottomLeftFront() -> BorderSpecs&
 {
     m_encoding.set(0);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::bottomLeftBack() -> BorderSpecs&
 {
     m_encoding.set(1);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::bottomRightFront() -> BorderSpecs&
 {
     m_encoding.set(2);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::bottomRightBack() -> BorderSpecs&
 {
     m_encoding.set(3);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::leftVertical() -> BorderSpecs&
 {
     m_encoding.set(4);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::backVertical() -> BorderSpecs&
 {
     m_encoding.set(5);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::rightVertical() -> BorderSpecs&
 {
     m_encoding.set(6);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::frontVertical() -> BorderSpecs&
 {
     m_encoding.set(7);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::topLeftBack() -> BorderSpecs&
 {
     m_encoding.set(8);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::topRightBack() -> BorderSpecs&
 {
     m_encoding.set(9);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::topLeftFront() -> BorderSpecs&
 {
     m_encoding.set(10);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::topRightFront() -> BorderSpecs&
 {
     m_encoding.set(11);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::polar() -> BorderSpecs&
 {
     m_encoding.set(2);
+    changed();
     return *this;
 }
 
 inline auto BorderSpecs::repr() const -> std::string
 {
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << "set border " << m_encoding.to_ulong() << " ";
     ss << DepthSpecsOf<BorderSpecs>::repr() << " ";
     ss << LineSpecsOf<BorderSpecs>::repr();
-    return internal::removeExtraWhitespaces(ss.str());
+    return ss.compact().release();
 }
 
 } // namespace sciplot
@@ -70,6 +70,7 @@ template <typename DerivedSpecs>
 auto DepthSpecsOf<DerivedSpecs>::front() -> DerivedSpecs&
 {
     m_depth = "front";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -77,6 +78,7 @@ template <typename DerivedSpecs>
 auto DepthSpecsOf<DerivedSpecs>::back() -> DerivedSpecs&
 {
     m_depth = "back";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -84,6 +86,7 @@ template <typename DerivedSpecs>
 auto DepthSpecsOf<DerivedSpecs>::behind() -> DerivedSpecs&
 {
     m_depth = "behind";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
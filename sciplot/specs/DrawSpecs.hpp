@@ -44,6 +44,18 @@ class DrawSpecs : public LineSpecsOf<DrawSpecs>, public PointSpecsOf<DrawSpecs>,
     /// @param with The string representing the `with plotstyle` expression (e.g., "lines", "linespoints", "dots")
     DrawSpecs(std::string what, std::string use, std::string with);
 
+    /// Set the string representing `what` to be plot (e.g., "'filename'", "sin(x)").
+    auto what(std::string what) -> DrawSpecs&;
+
+    /// Return the string representing `what` to be plot.
+    auto what() const -> std::string;
+
+    /// Set the string representing the `using` expression (e.g., "1:2", "4:6:8:9").
+    auto use(std::string use) -> DrawSpecs&;
+
+    /// Return the `using` expression, including the columns of tic labels (empty if gnuplot uses the default columns).
+    auto use() const -> std::string;
+
     /// Set the legend label of the plotted element.
     auto label(std::string text) -> DrawSpecs&;
 
@@ -94,63 +106,93 @@ inline DrawSpecs::DrawSpecs(std::string what, std::string use, std::string with)
     lineWidth(internal::DEFAULT_LINEWIDTH);
 }
 
+inline auto DrawSpecs::what(std::string what) -> DrawSpecs&
+{
+    m_what = what;
+    changed();
+    return *this;
+}
+
+inline auto DrawSpecs::what() const -> std::string
+{
+    return m_what;
+}
+
+inline auto DrawSpecs::use(std::string use) -> DrawSpecs&
+{
+    m_using = use;
+    changed();
+    return *this;
+}
+
+inline auto DrawSpecs::use() const -> std::string
+{
+    std::string use = m_using;
+    if(m_xtic.size()) use += ":" + m_xtic;
+    if(m_ytic.size()) use += ":" + m_ytic;
+    return use;
+}
+
 inline auto DrawSpecs::label(std::string text) -> DrawSpecs&
 {
     m_title = "title '" + text + "'";
+    changed();
     return *this;
 }
 
 inline auto DrawSpecs::labelFromColumnHeader() -> DrawSpecs&
 {
     m_title = "title columnheader";
+    changed();
     return *this;
 }
 
 inline auto DrawSpecs::labelFromColumnHeader(int icolumn) -> DrawSpecs&
 {
     m_title = "title columnheader(" + std::to_string(icolumn) + ")";
+    changed();
     return *this;
 }
 
 inline auto DrawSpecs::labelNone() -> DrawSpecs&
 {
     m_title = "notitle";
+    changed();
     return *this;
 }
 
 inline auto DrawSpecs::labelDefault() -> DrawSpecs&
 {
     m_title = "";
+    changed();
     return *this;
 }
 
 inline auto DrawSpecs::xtics(ColumnIndex icol) -> DrawSpecs&
 {
     m_xtic = "xtic(stringcolumn(" + icol.value + "))"; // xtic(stringcolumn(1)) or xtic(stringcolumn('Name'))
+    changed();
     return *this;
 }
 
 inline auto DrawSpecs::ytics(ColumnIndex icol) -> DrawSpecs&
 {
     m_ytic = "ytic(stringcolumn(" + icol.value + "))"; // ytic(stringcolumn(1)) or ytic(stringcolumn('Name'))
+    changed();
     return *this;
 }
 
 inline auto DrawSpecs::repr() const -> std::string
 {
-    std::string use = m_using;
-    if(m_xtic.size()) use += ":" + m_xtic;
-    if(m_ytic.size()) use += ":" + m_ytic;
-
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << m_what << " ";
-    ss << gnuplot::optionValueStr("using", use);
+    ss.option("using", use());
     ss << m_title << " ";
-    ss << gnuplot::optionValueStr("with", m_with);
+    ss.option("with", m_with);
     ss << LineSpecsOf<DrawSpecs>::repr() << " ";
     ss << PointSpecsOf<DrawSpecs>::repr() << " ";
     ss << FillSpecsOf<DrawSpecs>::repr() << " ";
-    return internal::removeExtraWhitespaces(ss.str());
+    return ss.compact().release();
 }
 
 } // namespace sciplot
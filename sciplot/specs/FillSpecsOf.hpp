@@ -111,6 +111,7 @@ template <typename DerivedSpecs>
 auto FillSpecsOf<DerivedSpecs>::fillEmpty() -> DerivedSpecs&
 {
     m_fillmode = "empty";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -118,6 +119,7 @@ template <typename DerivedSpecs>
 auto FillSpecsOf<DerivedSpecs>::fillSolid() -> DerivedSpecs&
 {
     m_fillmode = "solid";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -126,6 +128,7 @@ auto FillSpecsOf<DerivedSpecs>::fillPattern(int number) -> DerivedSpecs&
 {
     m_fillmode = "pattern";
     m_pattern_number = internal::str(number);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -133,6 +136,7 @@ template <typename DerivedSpecs>
 auto FillSpecsOf<DerivedSpecs>::fillColor(std::string color) -> DerivedSpecs&
 {
     m_fillcolor = "fillcolor '" + color + "'";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -142,6 +146,7 @@ auto FillSpecsOf<DerivedSpecs>::fillIntensity(double value) -> DerivedSpecs&
     value = std::min(std::max(0.0, value), 1.0); // value in [0, 1]
     m_density = internal::str(value);
     m_fillmode = "solid";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -151,6 +156,7 @@ auto FillSpecsOf<DerivedSpecs>::fillTransparent(bool active) -> DerivedSpecs&
     m_transparent = active ? "transparent" : "";
     if(m_fillmode.empty())
         m_fillmode = "solid";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -158,6 +164,7 @@ template <typename DerivedSpecs>
 auto FillSpecsOf<DerivedSpecs>::borderLineColor(std::string color) -> DerivedSpecs&
 {
     m_bordercolor = "'" + color + "'";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -165,6 +172,7 @@ template <typename DerivedSpecs>
 auto FillSpecsOf<DerivedSpecs>::borderLineWidth(int value) -> DerivedSpecs&
 {
     m_borderlinewidth = internal::str(value);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -172,6 +180,7 @@ template <typename DerivedSpecs>
 auto FillSpecsOf<DerivedSpecs>::borderShow(bool show) -> DerivedSpecs&
 {
     m_bordershow = show ? "yes" : "no";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -184,30 +193,27 @@ auto FillSpecsOf<DerivedSpecs>::borderHide() -> DerivedSpecs&
 template <typename DerivedSpecs>
 auto FillSpecsOf<DerivedSpecs>::repr() const -> std::string
 {
-    std::string fillstyle; // ensure it remains empty if no fill style option has been given!
+    internal::ScriptBuilder ss;
+    ss << m_fillcolor << " ";
+
+    // The fill style remains empty if no fill style option has been given!
     if(m_fillmode == "solid")
-        fillstyle = "fillstyle " + m_transparent + " solid " + m_density;
+        ss << "fillstyle " << m_transparent << " solid " << m_density << " ";
     else if(m_fillmode == "pattern")
-        fillstyle = "fillstyle " + m_transparent + " pattern " + m_pattern_number;
+        ss << "fillstyle " << m_transparent << " pattern " << m_pattern_number << " ";
     else if(m_fillmode == "empty")
-        fillstyle = "fillstyle empty";
+        ss << "fillstyle empty ";
 
-    std::string borderstyle; // ensure it remains empty if no border option has been given!
-    if(m_bordershow != "")
+    // The border style remains empty if no border option has been given!
+    if(m_bordershow == "yes")
     {
-        if(m_bordershow == "yes")
-        {
-            borderstyle  = "border ";
-            borderstyle += gnuplot::optionValueStr("linecolor", m_bordercolor);
-            borderstyle += gnuplot::optionValueStr("linewidth", m_borderlinewidth);
-        }
-        else borderstyle = "noborder";
+        ss << "border ";
+        ss.option("linecolor", m_bordercolor).option("linewidth", m_borderlinewidth);
     }
+    else if(m_bordershow != "")
+        ss << "noborder";
 
-    std::stringstream ss;
-    ss << m_fillcolor << " " << fillstyle << " " << borderstyle;
-
-    return internal::removeExtraWhitespaces(ss.str());
+    return ss.compact().release();
 }
 
 } // namespace sciplot
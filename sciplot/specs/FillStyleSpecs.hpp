@@ -99,12 +99,14 @@ inline FillStyleSpecs::FillStyleSpecs()
 inline auto FillStyleSpecs::empty() -> FillStyleSpecs&
 {
     m_fillmode = "empty";
+    changed();
     return *this;
 }
 
 inline auto FillStyleSpecs::solid() -> FillStyleSpecs&
 {
     m_fillmode = "solid";
+    changed();
     return *this;
 }
 
@@ -112,6 +114,7 @@ inline auto FillStyleSpecs::pattern(int number) -> FillStyleSpecs&
 {
     m_fillmode = "pattern";
     m_pattern_number = internal::str(number);
+    changed();
     return *this;
 }
 
@@ -120,6 +123,7 @@ inline auto FillStyleSpecs::intensity(double value) -> FillStyleSpecs&
     value = std::min(std::max(0.0, value), 1.0); // value in [0, 1]
     m_density = internal::str(value);
     m_fillmode = "solid";
+    changed();
     return *this;
 }
 
@@ -128,24 +132,28 @@ inline auto FillStyleSpecs::transparent(bool active) -> FillStyleSpecs&
     m_transparent = active ? "transparent" : "";
     if(m_fillmode.empty())
         m_fillmode = "solid";
+    changed();
     return *this;
 }
 
 inline auto FillStyleSpecs::borderLineColor(std::string color) -> FillStyleSpecs&
 {
     m_bordercolor = "'" + color + "'";
+    changed();
     return *this;
 }
 
 inline auto FillStyleSpecs::borderLineWidth(int value) -> FillStyleSpecs&
 {
     m_borderlinewidth = internal::str(value);
+    changed();
     return *this;
 }
 
 inline auto FillStyleSpecs::borderShow(bool show) -> FillStyleSpecs&
 {
     m_bordershow = show ? "yes" : "no";
+    changed();
     return *this;
 }
 
@@ -156,32 +164,30 @@ inline auto FillStyleSpecs::borderHide() -> FillStyleSpecs&
 
 inline auto FillStyleSpecs::repr() const -> std::string
 {
-    std::string fillstyle; // ensure it remains empty if no fill style option has been given!
+    if(m_fillmode != "solid" && m_fillmode != "pattern" && m_fillmode != "empty" && m_bordershow == "")
+        return "";
+
+    internal::ScriptBuilder ss;
+    ss << "set style fill ";
+
+    // The fill style remains empty if no fill style option has been given!
     if(m_fillmode == "solid")
-        fillstyle = m_transparent + " solid " + m_density;
+        ss << m_transparent << " solid " << m_density << " ";
     else if(m_fillmode == "pattern")
-        fillstyle = m_transparent + " pattern " + m_pattern_number;
+        ss << m_transparent << " pattern " << m_pattern_number << " ";
     else if(m_fillmode == "empty")
-        fillstyle = "empty";
+        ss << "empty ";
 
-    std::string borderstyle; // ensure it remains empty if no border option has been given!
-    if(m_bordershow != "")
+    // The border style remains empty if no border option has been given!
+    if(m_bordershow == "yes")
     {
-        if(m_bordershow == "yes")
-        {
-            borderstyle  = "border ";
-            borderstyle += gnuplot::optionValueStr("linecolor", m_bordercolor);
-            borderstyle += gnuplot::optionValueStr("linewidth", m_borderlinewidth);
-        }
-        else borderstyle = "noborder";
+        ss << "border ";
+        ss.option("linecolor", m_bordercolor).option("linewidth", m_borderlinewidth);
     }
+    else if(m_bordershow != "")
+        ss << "noborder";
 
-    if(fillstyle.empty() && borderstyle.empty())
-        return "";
-
-    std::string ss = "set style fill " + fillstyle + " " + borderstyle;
-
-    return internal::removeExtraWhitespaces(ss);
+    return ss.compact().release();
 }
 
 } // namespace sciplot
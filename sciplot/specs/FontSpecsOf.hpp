@@ -67,6 +67,7 @@ template <typename DerivedSpecs>
 auto FontSpecsOf<DerivedSpecs>::fontName(std::string name) -> DerivedSpecs&
 {
     m_fontname = name;
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -74,16 +75,17 @@ template <typename DerivedSpecs>
 auto FontSpecsOf<DerivedSpecs>::fontSize(std::size_t size) -> DerivedSpecs&
 {
     m_fontsize = std::to_string(size);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
 template <typename DerivedSpecs>
 auto FontSpecsOf<DerivedSpecs>::repr() const -> std::string
 {
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     if(m_fontname.size() || m_fontsize.size())
         ss << "font '" << m_fontname << "," << m_fontsize << "'";
-    return ss.str();
+    return ss.release();
 }
 
 } // namespace sciplot
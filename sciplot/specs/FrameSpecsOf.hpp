@@ -88,6 +88,7 @@ template <typename DerivedSpecs>
 auto FrameSpecsOf<DerivedSpecs>::frameShow(bool value) -> DerivedSpecs&
 {
     m_show = value;
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -101,6 +102,7 @@ template <typename DerivedSpecs>
 auto FrameSpecsOf<DerivedSpecs>::frameLineStyle(int value) -> DerivedSpecs&
 {
     m_line_specs.lineStyle(value);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -108,6 +110,7 @@ template <typename DerivedSpecs>
 auto FrameSpecsOf<DerivedSpecs>::frameLineType(int value) -> DerivedSpecs&
 {
     m_line_specs.lineType(value);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -115,6 +118,7 @@ template <typename DerivedSpecs>
 auto FrameSpecsOf<DerivedSpecs>::frameLineWidth(int value) -> DerivedSpecs&
 {
     m_line_specs.lineWidth(value);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -122,6 +126,7 @@ template <typename DerivedSpecs>
 auto FrameSpecsOf<DerivedSpecs>::frameLineColor(std::string value) -> DerivedSpecs&
 {
     m_line_specs.lineColor(value);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -129,6 +134,7 @@ template <typename DerivedSpecs>
 auto FrameSpecsOf<DerivedSpecs>::frameDashType(int value) -> DerivedSpecs&
 {
     m_line_specs.dashType(value);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -138,9 +144,9 @@ auto FrameSpecsOf<DerivedSpecs>::repr() const -> std::string
     if(m_show == false)
         return "nobox";
 
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << "box " << m_line_specs.repr();
-    return internal::removeExtraWhitespaces(ss.str());
+    return ss.compact().release();
 }
 
 } // namespace sciplot
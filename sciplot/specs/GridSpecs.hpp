@@ -25,6 +25,9 @@
 
 #pragma once
 
+// C++ includes
+#include <algorithm>
+
 // sciplot includes
 #include <sciplot/Default.hpp>
 #include <sciplot/specs/GridSpecsBase.hpp>
@@ -90,10 +93,14 @@ class GridSpecs : public GridSpecsBase
     /// Convert this GridSpecs object into a gnuplot formatted string.
     auto repr() const -> std::string;
 
+    /// Return true if the cached string representations of this object and of its grid lines along tics are up to date.
+    auto cached() const -> bool override;
+
   private:
     /// Auxiliary private method that adds a new specs object for grid lines along a major tics.
     auto _gridmajor(std::string tics) -> GridSpecsBase&
     {
+        changed();
         m_gridticsspecs.emplace_back(tics, true);
         return m_gridticsspecs.back();
     }
@@ -101,6 +108,7 @@ class GridSpecs : public GridSpecsBase
     /// Auxiliary private method that adds a new specs object for grid lines along a minor tics.
     auto _gridminor(std::string tics) -> GridSpecsBase&
     {
+        changed();
         m_gridticsspecs.emplace_back(tics, false);
         return m_gridticsspecs.back();
     }
@@ -119,12 +127,18 @@ inline GridSpecs::GridSpecs()
 
 inline auto GridSpecs::repr() const -> std::string
 {
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << GridSpecsBase::repr();
-    for (auto specs : m_gridticsspecs)
+    for (const auto& specs : m_gridticsspecs)
         ss << '\n'
-           << specs.repr();
-    return ss.str();
+           << specs.cachedRepr();
+    return ss.release();
+}
+
+inline auto GridSpecs::cached() const -> bool
+{
+    // The grid lines along tics are returned by reference, so they may have changed without this object being changed
+    return GridSpecsBase::cached() && std::all_of(m_gridticsspecs.begin(), m_gridticsspecs.end(), [](const GridSpecsBase& specs) { return specs.cached(); });
 }
 
 } // namespace sciplot
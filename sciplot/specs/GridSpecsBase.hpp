@@ -74,14 +74,14 @@ inline auto GridSpecsBase::repr() const -> std::string
     if(m_tics.size() && !visible)
         return "set grid no" + m_tics;
 
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << "set grid " << m_tics << " ";
     ss << DepthSpecsOf<GridSpecsBase>::repr() << " ";
     if(m_majortics)
         ss << LineSpecsOf<GridSpecsBase>::repr();
     else
-        ss << ", " + LineSpecsOf<GridSpecsBase>::repr(); // For minor tics, the preceding comma is needed
-    return internal::removeExtraWhitespaces(ss.str());
+        ss << ", " << LineSpecsOf<GridSpecsBase>::repr(); // For minor tics, the preceding comma is needed
+    return ss.compact().release();
 }
 
 } // namespace sciplot
@@ -83,6 +83,7 @@ inline HistogramStyleSpecs::HistogramStyleSpecs()
 inline auto HistogramStyleSpecs::clustered() -> HistogramStyleSpecs&
 {
     m_type = "clustered";
+    changed();
     return *this;
 }
 
@@ -90,24 +91,28 @@ inline auto HistogramStyleSpecs::clusteredWithGap(double value) -> HistogramStyl
 {
     m_type = "clustered";
     m_gap_clustered = "gap " + internal::str(value);
+    changed();
     return *this;
 }
 
 inline auto HistogramStyleSpecs::rowStacked() -> HistogramStyleSpecs&
 {
     m_type = "rowstacked";
+    changed();
     return *this;
 }
 
 inline auto HistogramStyleSpecs::columnStacked() -> HistogramStyleSpecs&
 {
     m_type = "columnstacked";
+    changed();
     return *this;
 }
 
 inline auto HistogramStyleSpecs::errorBars() -> HistogramStyleSpecs&
 {
     m_type = "errorbars";
+    changed();
     return *this;
 }
 
@@ -115,6 +120,7 @@ inline auto HistogramStyleSpecs::errorBarsWithGap(double value) -> HistogramStyl
 {
     m_type = "errorbars";
     m_gap_errorbars = "gap " + internal::str(value);
+    changed();
     return *this;
 }
 
@@ -122,6 +128,7 @@ inline auto HistogramStyleSpecs::errorBarsWithLineWidth(double value) -> Histogr
 {
     m_type = "errorbars";
     m_linewidth = "linewidth " + internal::str(value);
+    changed();
     return *this;
 }
 
@@ -130,13 +137,13 @@ inline auto HistogramStyleSpecs::repr() const -> std::string
     const auto supports_gap = (m_type == "clustered" || m_type == "errorbars");
     const auto supports_linewidth = (m_type == "errorbars");
 
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << "set style histogram" << " ";
     ss << m_type << " ";
     if(m_type == "clustered") ss << m_gap_clustered << " ";
     if(m_type == "errorbars") ss << m_gap_errorbars << " ";
     if(m_type == "errorbars") ss << m_linewidth << " ";
-    return internal::removeExtraWhitespaces(ss.str());
+    return ss.compact().release();
 }
 
 } // namespace sciplot
@@ -224,240 +224,280 @@ inline LegendSpecs::LegendSpecs()
 inline auto LegendSpecs::opaque() -> LegendSpecs&
 {
     m_opaque = "opaque";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::transparent() -> LegendSpecs&
 {
     m_opaque = "noopaque";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atLeft() -> LegendSpecs&
 {
     m_placement = "inside left";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atRight() -> LegendSpecs&
 {
     m_placement = "inside right";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atCenter() -> LegendSpecs&
 {
     m_placement = "inside center";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atTop() -> LegendSpecs&
 {
     m_placement = "inside center top";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atTopLeft() -> LegendSpecs&
 {
     m_placement = "inside left top";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atTopRight() -> LegendSpecs&
 {
     m_placement = "inside right top";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atBottom() -> LegendSpecs&
 {
     m_placement = "inside center bottom";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atBottomLeft() -> LegendSpecs&
 {
     m_placement = "inside left bottom";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atBottomRight() -> LegendSpecs&
 {
     m_placement = "inside right bottom";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atOutsideLeft() -> LegendSpecs&
 {
     m_placement = "lmargin center";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atOutsideLeftTop() -> LegendSpecs&
 {
     m_placement = "lmargin top";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atOutsideLeftBottom() -> LegendSpecs&
 {
     m_placement = "lmargin bottom";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atOutsideRight() -> LegendSpecs&
 {
     m_placement = "rmargin center";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atOutsideRightTop() -> LegendSpecs&
 {
     m_placement = "rmargin top";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atOutsideRightBottom() -> LegendSpecs&
 {
     m_placement = "rmargin bottom";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atOutsideBottom() -> LegendSpecs&
 {
     m_placement = "bmargin center";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atOutsideBottomLeft() -> LegendSpecs&
 {
     m_placement = "bmargin left";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atOutsideBottomRight() -> LegendSpecs&
 {
     m_placement = "bmargin right";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atOutsideTop() -> LegendSpecs&
 {
     m_placement = "tmargin center";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atOutsideTopLeft() -> LegendSpecs&
 {
     m_placement = "tmargin left";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::atOutsideTopRight() -> LegendSpecs&
 {
     m_placement = "tmargin right";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::titleLeft() -> LegendSpecs&
 {
     m_title_loc = "left";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::titleCenter() -> LegendSpecs&
 {
     m_title_loc = "center";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::titleRight() -> LegendSpecs&
 {
     m_title_loc = "right";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::displayVertical() -> LegendSpecs&
 {
     m_alignment = "vertical";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::displayVerticalMaxRows(int value) -> LegendSpecs&
 {
     m_maxrows = internal::str(value);
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::displayHorizontal() -> LegendSpecs&
 {
     m_alignment = "horizontal";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::displayHorizontalMaxCols(int value) -> LegendSpecs&
 {
     m_maxcols = internal::str(value);
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::displayLabelsBeforeSymbols() -> LegendSpecs&
 {
     m_reverse = "noreverse";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::displayLabelsAfterSymbols() -> LegendSpecs&
 {
     m_reverse = "reverse";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::displayJustifyLeft() -> LegendSpecs&
 {
     m_justification = "Left";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::displayJustifyRight() -> LegendSpecs&
 {
     m_justification = "Right";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::displayStartFromFirst() -> LegendSpecs&
 {
     m_invert = "noinvert";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::displayStartFromLast() -> LegendSpecs&
 {
     m_invert = "invert";
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::displaySpacing(int value) -> LegendSpecs&
 {
     m_spacing = value;
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::displayExpandWidthBy(int value) -> LegendSpecs&
 {
     m_width_increment = value;
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::displayExpandHeightBy(int value) -> LegendSpecs&
 {
     m_height_increment = value;
+    changed();
     return *this;
 }
 
 inline auto LegendSpecs::displaySymbolLength(int value) -> LegendSpecs&
 {
     m_samplen = value;
+    changed();
     return *this;
 }
 
@@ -471,7 +511,7 @@ inline auto LegendSpecs::repr() const -> std::string
     if(titlespecs.size())
         titlespecs += " " + m_title_loc; // attach left|center|right to title (e.g. title 'Legend' right)
 
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << "set key ";
     ss << m_placement << " " << m_opaque << " ";
     ss << m_alignment << " ";
@@ -487,7 +527,7 @@ inline auto LegendSpecs::repr() const -> std::string
     ss << FrameSpecsOf<LegendSpecs>::repr() << " ";
     ss << "maxrows " << m_maxrows << " ";
     ss << "maxcols " << m_maxcols << " ";
-    return internal::removeExtraWhitespaces(ss.str());
+    return ss.compact().release();
 }
 
 } // namespace sciplot
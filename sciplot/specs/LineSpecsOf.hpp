@@ -87,6 +87,7 @@ template <typename DerivedSpecs>
 auto LineSpecsOf<DerivedSpecs>::lineStyle(int value) -> DerivedSpecs&
 {
     m_linestyle = "linestyle " + internal::str(value);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -94,6 +95,7 @@ template <typename DerivedSpecs>
 auto LineSpecsOf<DerivedSpecs>::lineType(int value) -> DerivedSpecs&
 {
     m_linetype = "linetype " + internal::str(value);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -101,6 +103,7 @@ template <typename DerivedSpecs>
 auto LineSpecsOf<DerivedSpecs>::lineWidth(int value) -> DerivedSpecs&
 {
     m_linewidth = "linewidth " + internal::str(value);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -108,6 +111,7 @@ template <typename DerivedSpecs>
 auto LineSpecsOf<DerivedSpecs>::lineColor(std::string value) -> DerivedSpecs&
 {
     m_linecolor = "linecolor '" + value + "'";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -115,19 +119,20 @@ template <typename DerivedSpecs>
 auto LineSpecsOf<DerivedSpecs>::dashType(int value) -> DerivedSpecs&
 {
     m_dashtype = "dashtype " + internal::str(value);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
 template <typename DerivedSpecs>
 auto LineSpecsOf<DerivedSpecs>::repr() const -> std::string
 {
-    std::stringstream ss; // ensure it remains empty if no line style option has been given!
+    internal::ScriptBuilder ss; // ensure it remains empty if no line style option has been given!
     ss << m_linestyle << " ";
     ss << m_linetype << " ";
     ss << m_linewidth << " ";
     ss << m_linecolor << " ";
     ss << m_dashtype << " ";
-    return internal::removeExtraWhitespaces(ss.str());
+    return ss.compact().release();
 }
 
 } // namespace sciplot
@@ -81,6 +81,7 @@ template <typename DerivedSpecs>
 auto OffsetSpecsOf<DerivedSpecs>::shiftAlongX(double chars) -> DerivedSpecs&
 {
     xoffset = internal::str(chars);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -88,6 +89,7 @@ template <typename DerivedSpecs>
 auto OffsetSpecsOf<DerivedSpecs>::shiftAlongY(double chars) -> DerivedSpecs&
 {
     yoffset = internal::str(chars);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -95,6 +97,7 @@ template <typename DerivedSpecs>
 auto OffsetSpecsOf<DerivedSpecs>::shiftAlongGraphX(double val) -> DerivedSpecs&
 {
     xoffset = "graph " + internal::str(val);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -102,6 +105,7 @@ template <typename DerivedSpecs>
 auto OffsetSpecsOf<DerivedSpecs>::shiftAlongGraphY(double val) -> DerivedSpecs&
 {
     yoffset = "graph " + internal::str(val);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -109,6 +113,7 @@ template <typename DerivedSpecs>
 auto OffsetSpecsOf<DerivedSpecs>::shiftAlongScreenX(double val) -> DerivedSpecs&
 {
     xoffset = "screen " + internal::str(val);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -116,20 +121,17 @@ template <typename DerivedSpecs>
 auto OffsetSpecsOf<DerivedSpecs>::shiftAlongScreenY(double val) -> DerivedSpecs&
 {
     yoffset = "screen " + internal::str(val);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
 template <typename DerivedSpecs>
 auto OffsetSpecsOf<DerivedSpecs>::repr() const -> std::string
 {
-    std::string offset;
-
+    internal::ScriptBuilder ss;
     if(xoffset != "0" || yoffset != "0")
-        offset = "offset " + xoffset + ", " + yoffset;
-
-    std::stringstream ss;
-    ss << gnuplot::optionStr(offset);
-    return internal::removeExtraWhitespaces(ss.str());
+        ss << "offset " << xoffset << ", " << yoffset;
+    return ss.compact().release();
 }
 
 } // namespace sciplot
@@ -69,6 +69,7 @@ template <typename DerivedSpecs>
 auto PointSpecsOf<DerivedSpecs>::pointType(int value) -> DerivedSpecs&
 {
     m_pointtype = "pointtype " + internal::str(value);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -76,16 +77,17 @@ template <typename DerivedSpecs>
 auto PointSpecsOf<DerivedSpecs>::pointSize(int value) -> DerivedSpecs&
 {
     m_pointsize = "pointsize " + internal::str(value);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
 template <typename DerivedSpecs>
 auto PointSpecsOf<DerivedSpecs>::repr() const -> std::string
 {
-    std::stringstream ss; // ensure it remains empty if no point style option has been given!
+    internal::ScriptBuilder ss; // ensure it remains empty if no point style option has been given!
     ss << m_pointtype << " ";
     ss << m_pointsize;
-    return internal::removeExtraWhitespaces(ss.str());
+    return ss.compact().release();
 }
 
 } // namespace sciplot
@@ -68,6 +68,7 @@ template <typename DerivedSpecs>
 auto ShowSpecsOf<DerivedSpecs>::show(bool value) -> DerivedSpecs&
 {
     m_show = value;
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -26,36 +26,101 @@
 #pragma once
 
 // C++ includes
+#include <atomic>
+#include <mutex>
+#include <ostream>
 #include <string>
 
+// sciplot includes
+#include <sciplot/Utils.hpp>
+
 namespace sciplot {
 
 /// The base class for other specs classes (e.g., LineSpecsOf, DrawSpecs, BorderSpecs, etc.)
+/// The string representation of a specs object is cached by @ref cachedRepr, which is used to write the object to scripts,
+/// so that unchanged specs are not converted again on every render. Every setter marks the cached representation as outdated.
 template <typename DerivedSpecs>
 class Specs
 {
   public:
+    /// Construct a default Specs object.
+    Specs() = default;
+
+    /// Construct a copy of a Specs object, including its cached string representation.
+    Specs(const Specs& other)
+    {
+        std::lock_guard<std::mutex> lock(other.m_reprmutex);
+        m_repr = other.m_repr;
+        m_reprcached = other.m_reprcached.load();
+    }
+
+    /// Assign a copy of a Specs object, including its cached string representation.
+    auto operator=(const Specs& other) -> Specs&
+    {
+        if(this == &other)
+            return *this;
+        std::unique_lock<std::mutex> otherlock(other.m_reprmutex, std::defer_lock);
+        std::unique_lock<std::mutex> lock(m_reprmutex, std::defer_lock);
+        std::lock(otherlock, lock);
+        m_repr = other.m_repr;
+        m_reprcached = other.m_reprcached.load();
+        return *this;
+    }
+
     /// Pure virtual destructor (this class is an abstract base class).
     virtual ~Specs() = default;
 
     /// Return a string representation of this object of some class that derives from specs.
     virtual auto repr() const -> std::string = 0;
 
+    /// Return the string representation of this object, which is only generated again by @ref repr after the object has changed.
+    auto cachedRepr() const -> const std::string&
+    {
+        std::lock_guard<std::mutex> lock(m_reprmutex);
+        if(!cached())
+        {
+            m_repr = repr();
+            m_reprcached = true;
+        }
+        return m_repr;
+    }
+
     /// Return a string representation of this object of some class that derives from specs.
-    operator std::string() const { return repr(); }
+    operator std::string() const { return cachedRepr(); }
+
+    /// Return true if the cached string representation of this object is up to date.
+    /// Specs objects containing other specs objects that can be changed directly override this to check them too.
+    virtual auto cached() const -> bool { return m_reprcached; }
 
     /// Return a reference to the specs object of class derived from this.
     auto derived() -> DerivedSpecs& { return static_cast<DerivedSpecs&>(*this); }
 
     /// Return a const reference to the specs object of class derived from this.
     auto derived() const -> const DerivedSpecs& { return static_cast<const DerivedSpecs&>(*this); }
+
+  protected:
+    /// Mark the cached string representation of this object as outdated.
+    /// This must be called by every method that changes the object (e.g., every setter).
+    auto changed() -> void { m_reprcached = false; }
+
+  private:
+    mutable std::string m_repr;        ///< The cached string representation of this object
+    mutable std::atomic<bool> m_reprcached{false}; ///< True if the cached string representation of this object is up to date
+    mutable std::mutex m_reprmutex;    ///< The mutex protecting the cached string representation, so that const specs can be written by many threads
 };
 
 /// Output the state of a specs object to a ostream object.
 template <typename DerivedSpecs>
 auto operator<<(std::ostream& stream, const Specs<DerivedSpecs>& obj) -> std::ostream&
 {
-    return stream << obj.repr();
+    return stream << obj.cachedRepr();
+}
+
+/// Append the state of a specs object to a script.
+template <typename DerivedSpecs>
+auto operator<<(internal::ScriptBuilder& script, const Specs<DerivedSpecs>& obj) -> internal::ScriptBuilder&
+{
+    return script << obj.cachedRepr();
 }
 
 } // namespace sciplot
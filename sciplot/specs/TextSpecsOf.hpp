@@ -75,6 +75,7 @@ template <typename DerivedSpecs>
 auto TextSpecsOf<DerivedSpecs>::textColor(std::string color) -> DerivedSpecs&
 {
     m_color = "'" + color + "'";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -82,16 +83,17 @@ template <typename DerivedSpecs>
 auto TextSpecsOf<DerivedSpecs>::enhanced(bool value) -> DerivedSpecs&
 {
     m_enhanced = value ? "enhanced" : "noenhanced";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
 template <typename DerivedSpecs>
 auto TextSpecsOf<DerivedSpecs>::repr() const -> std::string
 {
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << m_enhanced << " textcolor " << m_color << " ";
     ss << FontSpecsOf<DerivedSpecs>::repr();
-    return internal::removeExtraWhitespaces(ss.str());
+    return ss.compact().release();
 }
 
 } // namespace sciplot
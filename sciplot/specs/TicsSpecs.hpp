@@ -62,12 +62,14 @@ inline TicsSpecs::TicsSpecs()
 inline auto TicsSpecs::stackFront() -> TicsSpecs&
 {
     m_depth = "front";
+    changed();
     return *this;
 }
 
 inline auto TicsSpecs::stackBack() -> TicsSpecs&
 {
     m_depth = "back";
+    changed();
     return *this;
 }
 
@@ -78,10 +80,10 @@ inline auto TicsSpecs::repr() const -> std::string
     if(isHidden())
         return baserepr;
 
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << baserepr << " ";
     ss << m_depth;
-    return internal::removeExtraWhitespaces(ss.str());
+    return ss.compact().release();
 }
 
 } // namespace sciplot
@@ -119,6 +119,7 @@ template <typename DerivedSpecs>
 auto TicsSpecsBaseOf<DerivedSpecs>::alongAxis() -> DerivedSpecs&
 {
     m_along = "axis";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -126,6 +127,7 @@ template <typename DerivedSpecs>
 auto TicsSpecsBaseOf<DerivedSpecs>::alongBorder() -> DerivedSpecs&
 {
     m_along = "border";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -133,6 +135,7 @@ template <typename DerivedSpecs>
 auto TicsSpecsBaseOf<DerivedSpecs>::mirror(bool value) -> DerivedSpecs&
 {
     m_mirror = value ? "mirror" : "nomirror";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -140,6 +143,7 @@ template <typename DerivedSpecs>
 auto TicsSpecsBaseOf<DerivedSpecs>::rotate(bool value) -> DerivedSpecs&
 {
     m_rotate = value ? "rotate" : "norotate";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -147,6 +151,7 @@ template <typename DerivedSpecs>
 auto TicsSpecsBaseOf<DerivedSpecs>::rotateBy(double degrees) -> DerivedSpecs&
 {
     m_rotate = "rotate by " + internal::str(degrees);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -154,6 +159,7 @@ template <typename DerivedSpecs>
 auto TicsSpecsBaseOf<DerivedSpecs>::insideGraph() -> DerivedSpecs&
 {
     m_inout = "in";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -161,6 +167,7 @@ template <typename DerivedSpecs>
 auto TicsSpecsBaseOf<DerivedSpecs>::outsideGraph() -> DerivedSpecs&
 {
     m_inout = "out";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -174,6 +181,7 @@ template <typename DerivedSpecs>
 auto TicsSpecsBaseOf<DerivedSpecs>::scaleMajorBy(double value) -> DerivedSpecs&
 {
     m_scalemajor = value;
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -181,6 +189,7 @@ template <typename DerivedSpecs>
 auto TicsSpecsBaseOf<DerivedSpecs>::scaleMinorBy(double value) -> DerivedSpecs&
 {
     m_scaleminor = value;
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -188,6 +197,7 @@ template <typename DerivedSpecs>
 auto TicsSpecsBaseOf<DerivedSpecs>::format(std::string fmt) -> DerivedSpecs&
 {
     m_format = "'" + fmt + "'";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -204,8 +214,8 @@ auto TicsSpecsBaseOf<DerivedSpecs>::repr(std::string axis) const -> std::string
     if(show == "no")
         return "unset " + axis + "tics";
 
-    std::stringstream ss;
-    ss << "set " + axis + "tics" << " ";
+    internal::ScriptBuilder ss;
+    ss << "set " << axis << "tics" << " ";
     ss << m_along << " ";
     ss << m_mirror << " ";
     ss << m_inout << " ";
@@ -214,7 +224,7 @@ auto TicsSpecsBaseOf<DerivedSpecs>::repr(std::string axis) const -> std::string
     ss << OffsetSpecsOf<DerivedSpecs>::repr() << " ";
     ss << TextSpecsOf<DerivedSpecs>::repr() << " ";
     ss << m_format;
-    return internal::removeExtraWhitespaces(ss.str());
+    return ss.compact().release();
 }
 
 } // namespace sciplot
@@ -112,6 +112,7 @@ inline auto TicsSpecsMajor::automatic() -> TicsSpecsMajor&
     m_end = "";
     m_increment = "";
     m_at = "";
+    changed();
     return *this;
 }
 
@@ -119,6 +120,7 @@ inline auto TicsSpecsMajor::start(double value) -> TicsSpecsMajor&
 {
     m_start = internal::str(value) + ", ";
     m_at = m_start + m_increment + m_end;
+    changed();
     return *this;
 }
 
@@ -126,6 +128,7 @@ inline auto TicsSpecsMajor::increment(double value) -> TicsSpecsMajor&
 {
     m_increment = internal::str(value);
     m_at = m_start + m_increment + m_end;
+    changed();
     return *this;
 }
 
@@ -133,6 +136,7 @@ inline auto TicsSpecsMajor::end(double value) -> TicsSpecsMajor&
 {
     m_end = ", " + internal::str(value);
     m_at = m_start + m_increment + m_end;
+    changed();
     return *this;
 }
 
@@ -140,59 +144,65 @@ inline auto TicsSpecsMajor::interval(double start, double increment, double end)
 {
     if(increment <= 0.0) throw std::runtime_error("The `increment` argument in method TicsSpecsMajor::interval must be positive.");
     if(end <= start) throw std::runtime_error("The `end` argument in method TicsSpecsMajor::interval must be greater than `start`.");
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << start << ", " << increment << ", " << end;
-    m_at = ss.str();
+    m_at = ss.release();
+    changed();
     return *this;
 }
 
 inline auto TicsSpecsMajor::at(const std::vector<double>& values) -> TicsSpecsMajor&
 {
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << "(";
     for(auto i = 0; i < values.size(); ++i)
         ss << (i == 0 ? "" : ", ") << values[i];
     ss << ")";
-    m_at = ss.str();
+    m_at = ss.release();
+    changed();
     return *this;
 }
 
 inline auto TicsSpecsMajor::at(const std::vector<double>& values, const std::vector<std::string>& labels) -> TicsSpecsMajor&
 {
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << "(";
     for(auto i = 0; i < values.size(); ++i)
         ss << (i == 0 ? "" : ", ") << "'" << labels[i] << "' " << values[i];
     ss << ")";
-    m_at = ss.str();
+    m_at = ss.release();
+    changed();
     return *this;
 }
 
 inline auto TicsSpecsMajor::add(const std::vector<double>& values) -> TicsSpecsMajor&
 {
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << "add (";
     for(auto i = 0; i < values.size(); ++i)
         ss << (i == 0 ? "" : ", ") << values[i];
     ss << ")";
-    m_add = ss.str();
+    m_add = ss.release();
+    changed();
     return *this;
 }
 
 inline auto TicsSpecsMajor::add(const std::vector<double>& values, const std::vector<std::string>& labels) -> TicsSpecsMajor&
 {
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << "add (";
     for(auto i = 0; i < values.size(); ++i)
         ss << (i == 0 ? "" : ", ") << "'" << labels[i] << "' " << values[i];
     ss << ")";
-    m_add = ss.str();
+    m_add = ss.release();
+    changed();
     return *this;
 }
 
 inline auto TicsSpecsMajor::logscale(bool value) -> TicsSpecsMajor&
 {
     m_logscale = value ? "logscale" : "";
+    changed();
     return *this;
 }
 
@@ -210,12 +220,12 @@ inline auto TicsSpecsMajor::repr() const -> std::string
     if(m_end.size() && m_start.empty())
         throw std::runtime_error("You have called method TicsSpecsMajor::end but not TicsSpecsMajor::start.");
 
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << baserepr << " ";
     ss << m_at << " ";
     ss << m_add << " ";
     ss << m_logscale << " ";
-    return internal::removeExtraWhitespaces(ss.str());
+    return ss.compact().release();
 }
 
 } // namespace sciplot
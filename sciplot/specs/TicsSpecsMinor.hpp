@@ -70,6 +70,7 @@ inline TicsSpecsMinor::TicsSpecsMinor(std::string axis)
 inline auto TicsSpecsMinor::automatic() -> TicsSpecsMinor&
 {
     m_frequency = "";
+    changed();
     return *this;
 }
 
@@ -77,6 +78,7 @@ inline auto TicsSpecsMinor::number(int value) -> TicsSpecsMinor&
 {
     value = std::max(value, 0);
     m_frequency = internal::str(value + 1);
+    changed();
     return *this;
 }
 
@@ -85,10 +87,10 @@ inline auto TicsSpecsMinor::repr() const -> std::string
     if(isHidden())
         return "unset m" + m_axis + "tics";
 
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << "set m" << m_axis << "tics" << " ";
     ss << m_frequency;
-    return internal::removeExtraWhitespaces(ss.str());
+    return ss.compact().release();
 }
 
 } // namespace sciplot
@@ -98,6 +98,7 @@ template <typename DerivedSpecs>
 auto TitleSpecsOf<DerivedSpecs>::title(std::string title) -> DerivedSpecs&
 {
     m_title = "'" + title + "'";
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -105,6 +106,7 @@ template <typename DerivedSpecs>
 auto TitleSpecsOf<DerivedSpecs>::titleShiftAlongX(double chars) -> DerivedSpecs&
 {
     m_offset_specs.shiftAlongX(chars);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -112,6 +114,7 @@ template <typename DerivedSpecs>
 auto TitleSpecsOf<DerivedSpecs>::titleShiftAlongY(double chars) -> DerivedSpecs&
 {
     m_offset_specs.shiftAlongY(chars);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -119,6 +122,7 @@ template <typename DerivedSpecs>
 auto TitleSpecsOf<DerivedSpecs>::titleShiftAlongGraphX(double val) -> DerivedSpecs&
 {
     m_offset_specs.shiftAlongGraphX(val);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -126,6 +130,7 @@ template <typename DerivedSpecs>
 auto TitleSpecsOf<DerivedSpecs>::titleShiftAlongGraphY(double val) -> DerivedSpecs&
 {
     m_offset_specs.shiftAlongGraphY(val);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -133,6 +138,7 @@ template <typename DerivedSpecs>
 auto TitleSpecsOf<DerivedSpecs>::titleShiftAlongScreenX(double val) -> DerivedSpecs&
 {
     m_offset_specs.shiftAlongScreenX(val);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -140,6 +146,7 @@ template <typename DerivedSpecs>
 auto TitleSpecsOf<DerivedSpecs>::titleShiftAlongScreenY(double val) -> DerivedSpecs&
 {
     m_offset_specs.shiftAlongScreenY(val);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -147,6 +154,7 @@ template <typename DerivedSpecs>
 auto TitleSpecsOf<DerivedSpecs>::titleTextColor(std::string color) -> DerivedSpecs&
 {
     m_text_specs.textColor(color);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -154,6 +162,7 @@ template <typename DerivedSpecs>
 auto TitleSpecsOf<DerivedSpecs>::titleFontName(std::string name) -> DerivedSpecs&
 {
     m_text_specs.fontName(name);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -161,6 +170,7 @@ template <typename DerivedSpecs>
 auto TitleSpecsOf<DerivedSpecs>::titleFontSize(int size) -> DerivedSpecs&
 {
     m_text_specs.fontSize(size);
+    this->changed();
     return static_cast<DerivedSpecs&>(*this);
 }
 
@@ -170,11 +180,11 @@ auto TitleSpecsOf<DerivedSpecs>::repr() const -> std::string
     if(m_title == "''")
         return "";
 
-    std::stringstream ss;
+    internal::ScriptBuilder ss;
     ss << "title " << m_title << " ";
     ss << m_text_specs.repr() << " ";
     ss << m_offset_specs.repr();
-    return internal::removeExtraWhitespaces(ss.str());
+    return ss.compact().release();
 }
 
 } // namespace sciplot
@@ -16,17 +16,18 @@ palettesdir = join(rootdir, 'deps/gnuplot-palettes')
 # The directory of the library sciplot (source dir)
 plotdir = join(rootdir, 'sciplot')
 
-# The sorted list of palette file names (that ends with .pal)
+# The list of palette file names (that ends with .pal)
 filenames = [filename for filename in os.listdir(palettesdir) if filename.endswith('.pal')]
-filenames.sort()
 
-# The list of pairs (palette name, palette .pal file contents)
+# The list of pairs (palette name, palette .pal file contents) sorted by name, as required by the binary search in sciplot::palettecommands
 palettes = []
 
 for filename in filenames:
     file = open(join(palettesdir, filename), 'r')
     palettes.append((filename[:-4], file.read()))
 
+palettes.sort(key=lambda palette: palette[0].encode())
+
 # Open the sciplot/Palettes.hpp file
 palettes_hpp = open(join(plotdir, 'Palettes.hpp'), 'w')
 
@@ -63,15 +64,26 @@ print(
 #pragma once
 
 // C++ includes
-#include <map>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 namespace sciplot {
 
-/// Gnuplot color palettes for sciplot adapted from https://github.com/Gnuplotting/gnuplot-palettes""")
+/// A gnuplot color palette.
+struct Palette
+{
+    std::string_view name;      ///< The name of the palette (e.g., "viridis")
+    std::string_view commands;  ///< The gnuplot commands defining the line styles and the colors of the palette
+};
+
+/// Gnuplot color palettes for sciplot adapted from https://github.com/Gnuplotting/gnuplot-palettes
+/// The palettes are sorted by name. The table is a constant without any dynamic initialization, shared by all translation units.""")
 
-# Print the std::map with keys equal to palette names and values as the pal file contents
-print('const std::map<std::string, std::string> palettes = {')
+# Print the constexpr table of palettes sorted by name, with the pal file contents
+print('inline constexpr Palette palettes[] = {')
 
 for (key, value) in palettes:
     key = repr(key).replace("'", '"')
@@ -81,6 +93,35 @@ for (key, value) in palettes:
 
 print('};')
 
+# Print the check of the order of the palettes and the binary search of a palette by name
+print(
+"""
+namespace internal {
+
+/// Return true if the palettes are sorted by name (with unique names), as required by @ref palettecommands.
+constexpr auto sortedpalettes() -> bool
+{
+    for(std::size_t i = 1; i < std::size(palettes); ++i)
+        if(!(palettes[i - 1].name < palettes[i].name))
+            return false;
+    return true;
+}
+
+static_assert(sortedpalettes(), "The palettes must be sorted by name.");
+
+} // namespace internal
+
+/// Return the gnuplot commands of the palette with given name, found by binary search in @ref palettes.
+/// @throws std::out_of_range if there is no palette with the given name.
+inline auto palettecommands(std::string_view name) -> std::string_view
+{
+    const auto it = std::lower_bound(std::begin(palettes), std::end(palettes), name,
+        [](const Palette& palette, std::string_view name) { return palette.name < name; });
+    if(it == std::end(palettes) || it->name != name)
+        throw std::out_of_range("There is no palette with name '" + std::string(name) + "'.");
+    return it->commands;
+}""")
+
 # Print the closing brace of namespace sciplot
 print()
 print('} // namespace sciplot')
@@ -0,0 +1,99 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <set>
+#include <string>
+#include <vector>
+#include <thread>
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// Test includes
+#include <tests/FakeGnuplot.hpp>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+#if !defined(_WIN32)
+
+// Run with a build configured with SCIPLOT_TESTS_THREAD_SANITIZER=ON to check for data races.
+TEST_CASE("Concurrent construction and rendering of plots and figures", "[threads]")
+{
+    // A stand-in for gnuplot that acknowledges print commands like gnuplot does
+    FakeGnuplot fake(sessioncommands());
+    const auto program = fake.program();
+
+    const std::size_t numthreads = 8;
+    const std::size_t numplots = 20;
+
+    const Vec x = linspace(0.0, 1.0, 1000);
+    const Vec y = sin(10.0 * x);
+
+    std::vector<std::vector<std::string>> scripts(numthreads);
+    std::vector<std::size_t> numsaved(numthreads, 0);
+
+    std::vector<std::thread> threads;
+    for(std::size_t t = 0; t < numthreads; ++t)
+    {
+        threads.emplace_back([&, t] {
+            GnuplotSession session(program);
+            for(std::size_t i = 0; i < numplots; ++i)
+            {
+                Plot plot;
+                plot.drawCurve(x, y);
+                plot.binaryData();
+                plot.drawPoints(view(x), view(y));
+                plot.downsample(100);
+                plot.binaryData(false);
+                plot.drawCurve(x, y);
+                scripts[t].push_back(plot.repr());
+                numsaved[t] += plot.save("plot.pdf", session);
+
+                Figure figure = {{ plot, plot }};
+                numsaved[t] += figure.save("figure.pdf", session);
+            }
+        });
+    }
+    for(auto& thread : threads)
+        thread.join();
+
+    // All renders succeeded, and every plot used data files of its own
+    std::set<std::string> datafiles;
+    for(std::size_t t = 0; t < numthreads; ++t)
+    {
+        CHECK( numsaved[t] == 2 * numplots );
+        for(const auto& script : scripts[t])
+        {
+            const auto begin = script.find("'", script.find("PLOT COMMANDS")) + 1;
+            datafiles.insert(script.substr(begin, script.find("'", begin) - begin));
+        }
+    }
+    CHECK( datafiles.size() == numthreads * numplots );
+}
+
+#endif
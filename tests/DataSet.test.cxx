@@ -0,0 +1,100 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// sciplot includes
+#include <sciplot/DataSet.hpp>
+using namespace sciplot;
+
+TEST_CASE("DataSet", "[dataset]")
+{
+    std::vector<double> x = { 1.0, 2.0, 3.0 };
+    std::vector<int> y = { 4, 5, 6, 7 };
+    const Strings z = { "a", "b", "c" };
+
+    // Vectors are copied into the data set
+    auto copied = internal::makedataset(x, y);
+    x[0] = 10.0;
+
+    CHECK( copied->size() == 3 );
+    CHECK( copied->binaryformat() == "%double%double" );
+    CHECK( copied->recordsize() == 2 * sizeof(double) );
+
+    std::ostringstream text;
+    gnuplot::writedataset(text, 4, *copied);
+    CHECK( text.str() ==
+        "#==============================================================================\n"
+        "# DATASET #4\n"
+        "#==============================================================================\n"
+        "1 4\n2 5\n3 6\n\n\n" );
+
+    // Views are only read when the data set is written
+    auto viewed = internal::makedataset(view(x), view(y));
+    x[1] = 20.0;
+
+    std::ostringstream viewtext;
+    viewed->write(viewtext);
+    CHECK( viewtext.str() == "10 4\n20 5\n3 6\n" );
+
+    std::ostringstream binary;
+    gnuplot::writebinarydataset(binary, *viewed);
+    CHECK( binary.str().size() == 3 * viewed->recordsize() );
+
+    // Views created from shared pointers share the ownership of the vectors
+    auto shared = std::make_shared<std::vector<float>>(std::vector<float>{ 0.5f, 1.5f });
+    auto owned = internal::makedataset(view(shared), z);
+    shared.reset();
+
+    std::ostringstream ownedtext;
+    owned->write(ownedtext);
+    CHECK( ownedtext.str() == "0.5 \"a\"\n1.5 \"b\"\n" );
+    CHECK_THROWS( owned->writebinary(binary) );
+
+    // Data sets can be embedded in scripts as named datablocks
+    std::ostringstream datablock;
+    gnuplot::writedatablock(datablock, "$DATA_2", *owned);
+    CHECK( datablock.str() == "$DATA_2 << EOD\n0.5 \"a\"\n1.5 \"b\"\nEOD\n" );
+
+    // Columns of data sets are hashed and written individually
+    auto first = internal::makedataset(std::vector<double>{ 1, 2, 3 }, std::vector<double>{ 4, 5, 6 });
+    auto second = internal::makedataset(std::vector<double>{ 1, 2, 3 }, std::vector<double>{ 7, 8, 9 });
+
+    CHECK( first->numcolumns() == 2 );
+    CHECK( first->numeric() );
+    CHECK_FALSE( owned->numeric() );
+    CHECK( first->columnhash(0) == second->columnhash(0) );
+    CHECK( first->columnhash(1) != second->columnhash(1) );
+    CHECK( first->columnhash(0) != internal::makedataset(std::vector<float>{ 1, 2, 3 })->columnhash(0) );
+
+    std::ostringstream columns;
+    gnuplot::writedataset(columns, 1, { { first.get(), 0 }, { first.get(), 1 }, { second.get(), 1 } });
+    CHECK( columns.str() ==
+        "#==============================================================================\n"
+        "# DATASET #1\n"
+        "#==============================================================================\n"
+        "1 4 7\n2 5 8\n3 6 9\n\n\n" );
+}
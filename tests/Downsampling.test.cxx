@@ -0,0 +1,109 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// Test includes
+#include <tests/Files.hpp>
+
+// sciplot includes
+#include <sciplot/Downsampling.hpp>
+#include <sciplot/Plot.hpp>
+#include <sciplot/Vec.hpp>
+using namespace sciplot;
+
+TEST_CASE("LTTB downsampling", "[downsampling]")
+{
+    const Vec x = linspace(0.0, 10.0, 9999);
+    Vec y = std::sin(x);
+    y[5000] = 100.0; // a spike that must survive the downsampling
+
+    const auto indices = internal::lttb(x, y, 100);
+
+    CHECK( indices.size() == 100 );
+    CHECK( indices.front() == 0 );
+    CHECK( indices.back() == x.size() - 1 );
+    CHECK( std::is_sorted(indices.begin(), indices.end()) );
+    CHECK( std::adjacent_find(indices.begin(), indices.end()) == indices.end() );
+    CHECK( std::find(indices.begin(), indices.end(), 5000) != indices.end() );
+
+    // Curves with at most the requested number of points are kept as they are
+    CHECK( internal::lttb(x, y, x.size()).size() == x.size() );
+    CHECK( internal::lttb(x, y, 0).size() == x.size() );
+
+    const auto xs = internal::gather(x, indices);
+    const auto ys = internal::gather(y, indices);
+    CHECK( xs.size() == 100 );
+    CHECK( xs[0] == x[0] );
+    CHECK( ys[99] == y[x.size() - 1] );
+}
+
+TEST_CASE("M4 aggregation", "[downsampling]")
+{
+    const Vec x = linspace(0.0, 10.0, 99999);
+    Vec y = std::sin(x);
+    y[5000] = 100.0; // spikes that must survive the aggregation
+    y[7000] = -100.0;
+
+    const auto indices = internal::m4(x, y, 300);
+
+    CHECK( indices.size() <= 4 * 300 );
+    CHECK( indices.front() == 0 );
+    CHECK( indices.back() == x.size() - 1 );
+    CHECK( std::is_sorted(indices.begin(), indices.end()) );
+    CHECK( std::adjacent_find(indices.begin(), indices.end()) == indices.end() );
+    CHECK( std::find(indices.begin(), indices.end(), 5000) != indices.end() );
+    CHECK( std::find(indices.begin(), indices.end(), 7000) != indices.end() );
+
+    // The buckets aggregated in parallel produce the same points
+    CHECK( internal::m4(x, y, 300, 4) == internal::m4(x, y, 300, 1) );
+    CHECK( internal::m4(x, y, 7, 16) == internal::m4(x, y, 7, 1) );
+
+    // Curves with at most four points per pixel column are kept as they are
+    CHECK( internal::m4(x, y, x.size()).size() == x.size() );
+    CHECK( internal::m4(x, y, 0).size() == x.size() );
+}
+
+TEST_CASE("Plot::downsampleMinMax", "[downsampling]")
+{
+    Vec x = linspace(0.0, 1.0, 10);
+    Vec y = x;
+
+    Plot plot;
+    plot.downsampleMinMax();
+    plot.autoclean(false);
+    plot.drawCurve(view(x), view(y));
+
+    // A curve kept whole by the aggregation is drawn from its views, whose data is only read when the plot data is saved
+    y[3] = 42.0;
+    plot.savePlotData();
+
+    const auto script = plot.repr();
+    const auto begin = script.find("'plot") + 1;
+    const auto datafile = script.substr(begin, script.find('\'', begin) - begin);
+    CHECK( readfile(datafile).find("42") != std::string::npos );
+    plot.cleanup();
+}
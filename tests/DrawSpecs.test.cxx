@@ -60,4 +60,8 @@ TEST_CASE("DrawSpecs", "[specs]")
 
     specs.xtics("Country");
     CHECK( specs.repr() == "'file.dat' using 1:2:xtic(stringcolumn('Country')):ytic(stringcolumn(9)) title 'OnlyData' with lines linewidth 3 linecolor 'orange'" );
+    CHECK( specs.use() == "1:2:xtic(stringcolumn('Country')):ytic(stringcolumn(9))" );
+
+    specs.what("'other.dat' index 2").use("3:1");
+    CHECK( specs.repr() == "'other.dat' index 2 using 3:1:xtic(stringcolumn('Country')):ytic(stringcolumn(9)) title 'OnlyData' with lines linewidth 3 linecolor 'orange'" );
 }
@@ -0,0 +1,105 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+#if !defined(_WIN32)
+
+/// A stand-in for gnuplot, found first in PATH while this object is alive: a shell script named `gnuplot` in a directory of its own.
+/// PATH is restored and the directory removed on destruction, also when a failed assertion ends the test early.
+class FakeGnuplot
+{
+  public:
+    /// Construct a FakeGnuplot object running given shell commands (without the `#!/bin/sh` line).
+    explicit FakeGnuplot(const std::string& commands)
+    : m_directory("sciplot-fake-gnuplot-" + std::to_string(m_counter++))
+    {
+        const auto path = std::getenv("PATH");
+        m_path = path ? path : "";
+        std::filesystem::create_directory(m_directory);
+        write(commands);
+        setenv("PATH", (m_directory + ":" + m_path).c_str(), 1);
+    }
+
+    /// Destroy this FakeGnuplot object, restoring PATH and removing its directory.
+    ~FakeGnuplot()
+    {
+        setenv("PATH", m_path.c_str(), 1);
+        std::error_code ec;
+        std::filesystem::remove_all(m_directory, ec);
+    }
+
+    FakeGnuplot(const FakeGnuplot&) = delete;
+    auto operator=(const FakeGnuplot&) -> FakeGnuplot& = delete;
+
+    /// Replace the shell commands run by the stand-in.
+    auto write(const std::string& commands) -> void
+    {
+        std::ofstream(program()) << "#!/bin/sh\n" << commands;
+        std::filesystem::permissions(program(), std::filesystem::perms::owner_all);
+    }
+
+    /// Return the path of the stand-in (e.g., for a GnuplotSession that must not depend on PATH).
+    auto program() const -> std::string { return m_directory + "/gnuplot"; }
+
+    /// Return the directory of the stand-in, which can hold files written by it (removed on destruction).
+    auto directory() const -> const std::string& { return m_directory; }
+
+  private:
+    static inline int m_counter = 0; ///< The number of stand-ins created so far, used to name their directories
+    std::string m_directory;         ///< The directory of the stand-in
+    std::string m_path;              ///< The value of PATH before the stand-in was created
+};
+
+/// Return the shell commands of a stand-in for gnuplot reading its script from the standard input, as in a GnuplotSession.
+/// Print commands are acknowledged like gnuplot does (on the standard error, unless redirected to a file with `set print`),
+/// and the lines of the script matching the given additional `case` patterns run their commands.
+inline auto sessioncommands(const std::string& cases = "") -> std::string
+{
+    return "while IFS= read -r line; do\n"
+           "  case \"$line\" in\n"
+           "    'set print') printed= ;;\n"
+           "    'set print '*) printed=sciplot-session-print.txt ;;\n"
+           "    'print \"'*) token=${line#print \\\"}; token=\"${token%%\\\"*} 0\"\n"
+           "      if [ -n \"$printed\" ]; then echo \"$token\" >> \"$printed\"; else echo \"$token\" >&2; fi ;;\n" +
+           cases +
+           "  esac\n"
+           "done\n";
+}
+
+/// Return the shell commands of a stand-in for gnuplot writing given contents to the output files of the script file given as argument.
+inline auto writeoutputs(const std::string& contents) -> std::string
+{
+    return "sed -n \"s/^set output '\\(.*\\)'$/\\1/p\" \"$1\" | while read f; do echo " + contents + " > \"$f\"; done\n";
+}
+
+#endif
@@ -0,0 +1,125 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <filesystem>
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// Test includes
+#include <tests/Files.hpp>
+
+// sciplot includes
+#include <sciplot/Figure.hpp>
+using namespace sciplot;
+
+TEST_CASE("Figure::sharedData", "[figure]")
+{
+    const std::string directory = "sciplot-figure-scratch";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directory(directory);
+
+    const std::vector<double> x = { 1, 2, 3 };
+    const std::vector<double> y1 = { 4, 5, 6 };
+    const std::vector<double> y2 = { 7, 8, 9 };
+    const Strings names = { "a", "b", "c" };
+
+    Plot plot1, plot2, plot3;
+    plot1.drawCurve(x, y1);
+    plot1.drawBoxes(names, y1);
+    plot2.drawCurve(x, y2);
+    plot2.drawCurve(x, y1);
+    plot3.drawBoxes(names, y1);
+
+    scratchDirectory(directory);
+    Figure figure = {{ plot1, plot2 }, { plot3 }};
+    scratchDirectory("");
+
+    figure.sharedData();
+    figure.autoclean(false);
+    figure.save("figure.pdf"); // writes the script file, whether gnuplot is found or not
+
+    // The columns of numeric data sets with the same number of rows are saved once, and identical data sets are saved once
+    const auto data = readscratchfile(directory, "figure");
+    CHECK( data.find("1 4 7\n2 5 8\n3 6 9\n") != std::string::npos );
+    CHECK( data.find("\"a\" 4\n\"b\" 5\n\"c\" 6\n") != std::string::npos );
+    CHECK( data.find("# DATASET #2") == std::string::npos );
+
+    // The plots draw the shared data file with explicit columns
+    const auto script = readscratchfile(directory, "multishow");
+    CHECK( script.find(".dat' index 0 using 1:2 with lines") != std::string::npos );
+    CHECK( script.find(".dat' index 0 using 1:3 with lines") != std::string::npos );
+    CHECK( script.find(".dat' index 1 using 0:2:xtic(1) with boxes") != std::string::npos );
+    CHECK( script.find("'plot") == std::string::npos );
+
+    figure.cleanup();
+    CHECK( readscratchfile(directory, "figure").empty() );
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("Figure plot commands and data are generated in layout order", "[figure]")
+{
+    std::vector<std::vector<Plot>> plots(8);
+    for(std::size_t i = 0; i < plots.size(); ++i)
+    {
+        for(std::size_t j = 0; j < 4; ++j)
+        {
+            Plot plot;
+            plot.xlabel("panel-" + internal::str(4 * i + j));
+            plot.drawCurve(std::vector<double>{ 0, 1 }, std::vector<double>{ double(i), double(j) });
+            plots[i].push_back(plot);
+        }
+    }
+
+    const std::string directory = "sciplot-figure-scratch";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directory(directory);
+    scratchDirectory(directory);
+    Figure figure(plots);
+    scratchDirectory("");
+
+    figure.autoclean(false);
+    figure.save("figure.pdf");
+
+    // The plot commands of the plots are concatenated in layout order
+    const auto script = readscratchfile(directory, "multishow");
+    std::size_t position = 0;
+    for(std::size_t k = 0; k < 32; ++k)
+    {
+        const auto next = script.find("'panel-" + internal::str(k) + "'");
+        REQUIRE( next != std::string::npos );
+        CHECK( next > position );
+        position = next;
+    }
+
+    // The data of each plot is saved in its own file
+    const auto repr = plots[7][3].repr();
+    const auto begin = repr.find("'plot") + 1;
+    CHECK( readfile(repr.substr(begin, repr.find('\'', begin) - begin)).find("0 7\n1 3\n") != std::string::npos );
+
+    figure.cleanup();
+    std::filesystem::remove_all(directory);
+}
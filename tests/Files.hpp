@@ -0,0 +1,55 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+// C++ includes
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+/// Return the contents of a file (empty if it cannot be read).
+inline auto readfile(const std::string& filename) -> std::string
+{
+    std::ifstream file(filename, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+/// Write given contents to a file, replacing it if it exists.
+inline auto writefile(const std::string& filename, const std::string& contents) -> void
+{
+    std::ofstream(filename, std::ios::binary) << contents;
+}
+
+/// Return the contents of the first file in a directory whose name starts with given prefix (empty if there is none),
+/// such as a temporary file of a plot or figure saved in a scratch directory (see @ref scratchDirectory).
+inline auto readscratchfile(const std::string& directory, const std::string& prefix) -> std::string
+{
+    for(const auto& entry : std::filesystem::directory_iterator(directory))
+        if(entry.path().filename().string().rfind(prefix, 0) == 0)
+            return readfile(entry.path().string());
+    return "";
+}
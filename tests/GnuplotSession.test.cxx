@@ -0,0 +1,108 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// Test includes
+#include <tests/FakeGnuplot.hpp>
+
+// sciplot includes
+#include <sciplot/GnuplotSession.hpp>
+using namespace sciplot;
+
+#if !defined(_WIN32)
+
+TEST_CASE("GnuplotSession", "[session]")
+{
+    // A stand-in for gnuplot that acknowledges print commands like gnuplot does and exits on errors
+    FakeGnuplot fake(sessioncommands(
+        "    flood*) yes warning | head -n 20000 >&2 ;;\n"
+        "    error*) echo \"error in script\" >&2; exit 1 ;;\n"
+        "    hang*) exec sleep 5 ;;\n"));
+
+    GnuplotSession session(fake.program());
+    CHECK_FALSE( session.running() );
+
+    // The gnuplot process is started once and kept alive between scripts
+    CHECK( session.run("set output 'a.pdf'") );
+    CHECK( session.running() );
+    CHECK( session.run("set output 'b.pdf'") );
+    CHECK( session.running() );
+
+    // An error terminates the gnuplot process, which is started again by the next script
+    CHECK_FALSE( session.run("error") );
+    CHECK_FALSE( session.running() );
+    CHECK( session.run("set output 'c.pdf'") );
+    CHECK( session.running() );
+
+    // A script exceeding its timeout kills the gnuplot process, which is started again by the next script
+    CHECK_FALSE( session.run("hang", 0.2) );
+    CHECK( session.timedout() );
+    CHECK_FALSE( session.running() );
+    CHECK( session.run("set output 'd.pdf'", 5.0) );
+    CHECK_FALSE( session.timedout() );
+
+    // A script that gnuplot stops reading kills the gnuplot process once its timeout is exceeded
+    std::string stalled = "hang\n";
+    for(auto i = 0; i < 4096; ++i)
+        stalled += "# a comment line padding the script\n";
+    CHECK_FALSE( session.run(stalled, 0.2) );
+    CHECK( session.timedout() );
+    CHECK_FALSE( session.running() );
+
+    // The completion of a script redirecting the output of print commands to a file is still acknowledged
+    CHECK( session.run("set print \"x\"", 5.0) );
+    CHECK_FALSE( session.timedout() );
+    std::remove("sciplot-session-print.txt");
+
+    // A long script is written while gnuplot prints more messages than a pipe can hold, which are forwarded to the standard error
+    std::string longscript = "flood\n";
+    for(auto i = 0; i < 4096; ++i)
+        longscript += "# a comment line padding the script\n";
+    std::ostringstream messages;
+    auto cerrbuf = std::cerr.rdbuf(messages.rdbuf());
+    const auto flooded = session.run(longscript, 10.0);
+    std::cerr.rdbuf(cerrbuf);
+    CHECK( flooded );
+    const auto forwarded = messages.str();
+    CHECK( std::count(forwarded.begin(), forwarded.end(), '\n') == 20000 );
+
+    session.close();
+    CHECK_FALSE( session.running() );
+
+    // A missing gnuplot executable fails every script
+    GnuplotSession missing("sciplot-missing-gnuplot");
+    CHECK_FALSE( missing.run("set output") );
+}
+
+#endif
@@ -0,0 +1,235 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// Test includes
+#include <tests/FakeGnuplot.hpp>
+#include <tests/Files.hpp>
+
+// sciplot includes
+#include <sciplot/Figure.hpp>
+#include <sciplot/Plot.hpp>
+#include <sciplot/RenderCache.hpp>
+using namespace sciplot;
+
+TEST_CASE("Plot::inlineData", "[plot]")
+{
+    Plot plot;
+    plot.drawCurve(std::vector<double>{ 1, 2 }, std::vector<double>{ 3, 4 });
+    plot.inlineData();
+    plot.drawCurve(std::vector<double>{ 5, 6 }, std::vector<double>{ 7, 8 });
+    plot.drawBoxes(Strings{ "a", "b" }, std::vector<double>{ 9, 10 });
+
+    const auto script = plot.repr();
+
+    // Data sets drawn in inline mode are embedded at the top of the script and referenced by their datablock names
+    CHECK( script.find("$DATA_0 << EOD\n5 7\n6 8\nEOD\n$DATA_1 << EOD\n\"a\" 9\n\"b\" 10\nEOD\n") != std::string::npos );
+    CHECK( script.find("$DATA_0 << EOD") < script.find("SETUP COMMANDS") );
+    CHECK( script.find("    $DATA_0 with lines") != std::string::npos );
+    CHECK( script.find("    $DATA_1 using 0:2:xtic(1) with boxes") != std::string::npos );
+
+    // Data sets drawn before are still saved in the data file
+    CHECK( script.find(".dat' index 0 with lines") != std::string::npos );
+
+    plot.clear();
+    CHECK( plot.repr().find("EOD") == std::string::npos );
+}
+
+TEST_CASE("Plot scratch files", "[plot]")
+{
+    scratchDirectory("/dev/shm");
+    Plot plot;
+    scratchDirectory("");
+
+    // The data file of the plot is in the scratch directory, and its name contains the process id
+    plot.drawCurve(std::vector<double>{ 1, 2 }, std::vector<double>{ 3, 4 });
+    CHECK( plot.repr().find("'/dev/shm/plot" + internal::str(internal::processid()) + "-") != std::string::npos );
+}
+
+#if !defined(_WIN32)
+
+TEST_CASE("Plot::saveAsync", "[plot]")
+{
+    // A stand-in for gnuplot, found first in PATH, that succeeds only for scripts drawing a data set
+    FakeGnuplot fake("grep -q \"index 0\" \"$1\"\n");
+
+    Plot plot;
+    plot.drawCurve(std::vector<double>{ 1, 2, 3 }, std::vector<double>{ 4, 5, 6 });
+
+    // The plot is saved from a snapshot, so it can be changed right after the call
+    auto result = plot.saveAsync("plot.pdf");
+    plot.clear();
+    CHECK( result.get() );
+
+    // The render result is carried by the future
+    CHECK_FALSE( plot.saveAsync("plot.pdf").get() );
+
+    Plot other;
+    other.drawPoints(std::vector<double>{ 1, 2 }, std::vector<double>{ 3, 4 });
+    Figure figure = {{ other }};
+    auto figresult = figure.saveAsync("figure.pdf");
+    other.clear();
+    CHECK( figresult.get() );
+}
+
+TEST_CASE("Plot::saveAsync with views", "[plot]")
+{
+    // A stand-in for gnuplot, found first in PATH, that copies the first data file drawn by the script to the output file after a while
+    FakeGnuplot fake("sleep 0.3\n"
+                     "data=$(sed -n \"s/^    '\\([^']*\\)' index.*/\\1/p\" \"$1\" | head -n 1)\n"
+                     "cp \"$data\" \"$(sed -n \"s/^set output '\\(.*\\)'$/\\1/p\" \"$1\")\"\n");
+
+    std::vector<double> x = { 1, 2, 3 };
+    std::vector<double> y = { 4, 5, 6 };
+
+    Plot plot;
+    plot.drawCurve(view(x), view(y));
+    Figure figure = {{ plot }};
+    auto first = plot.saveAsync("first.txt");
+    auto third = figure.saveAsync("third.txt");
+
+    // The viewed vectors are changed, and the plot is saved again with other data, before the first saves complete
+    y = { 7, 8, 9 };
+    plot.clear();
+    plot.drawCurve(x, y);
+    auto second = plot.saveAsync("second.txt");
+
+    CHECK( first.get() );
+    CHECK( second.get() );
+    CHECK( third.get() );
+    CHECK( readfile("first.txt").find("4") != std::string::npos );
+    CHECK( readfile("first.txt").find("7") == std::string::npos );
+    CHECK( readfile("second.txt").find("7") != std::string::npos );
+    CHECK( readfile("third.txt") == readfile("first.txt") );
+
+    for(const auto& filename : { "first.txt", "second.txt", "third.txt" })
+        std::remove(filename);
+}
+
+TEST_CASE("Plot::render", "[plot]")
+{
+    // A stand-in for gnuplot, found first in PATH, that writes binary image bytes to its standard output if the script asks for it
+    FakeGnuplot fake("grep -q \"^set terminal png \" \"$1\" && grep -q \"^set output$\" \"$1\" || exit 1\n"
+                     "printf 'PNG\\000\\377'\n");
+
+    const std::vector<std::byte> expected = { std::byte('P'), std::byte('N'), std::byte('G'), std::byte(0), std::byte(0xff) };
+
+    Plot plot;
+    plot.drawCurve(std::vector<double>{ 1, 2, 3 }, std::vector<double>{ 4, 5, 6 });
+
+    // The image is returned in memory, without any output file
+    CHECK( plot.render("png") == expected );
+
+    // The image is written to an output stream
+    std::ostringstream out;
+    CHECK( plot.render("png", out) );
+    CHECK( out.str() == std::string("PNG\0\xff", 5) );
+
+    // Nothing is returned if gnuplot fails
+    CHECK( plot.render("svg").empty() );
+
+    Figure figure = {{ plot }};
+    CHECK( figure.render("png") == expected );
+}
+
+TEST_CASE("Plot::save in several files", "[plot]")
+{
+    // A stand-in for gnuplot, found first in PATH, that writes the output files of the script and keeps a copy of the script of each run
+    FakeGnuplot fake("cat \"$1\" >> \"$(dirname \"$0\")/scripts\"\n" + writeoutputs("rendered"));
+
+    auto count = [](const std::string& text, const std::string& what) {
+        std::size_t n = 0;
+        for(auto pos = text.find(what); pos != std::string::npos; pos = text.find(what, pos + 1))
+            ++n;
+        return n;
+    };
+    const auto scriptsfile = fake.directory() + "/scripts";
+    auto scripts = [&] {
+        const auto text = readfile(scriptsfile);
+        std::remove(scriptsfile.c_str());
+        return text;
+    };
+
+    std::vector<RenderStats> reported;
+
+    Plot plot;
+    plot.drawCurve(std::vector<double>{ 1, 2, 3 }, std::vector<double>{ 4, 5, 6 });
+    plot.renderCallback([&](const RenderStats& stats) { reported.push_back(stats); });
+
+    // A single gnuplot run saves all files, drawing the plot once and replotting it in the other formats
+    CHECK( plot.save({ "multi.png", "multi.pdf", "multi.svg" }) );
+    const auto script = scripts();
+    CHECK( count(script, "set terminal png ") == 1 );
+    CHECK( count(script, "set terminal pdf ") == 1 );
+    CHECK( count(script, "set terminal svg ") == 1 );
+    CHECK( count(script, "\nplot ") == 1 );
+    CHECK( count(script, "\nreplot\n") == 2 );
+    REQUIRE( reported.size() == 1 );
+    CHECK( reported[0].filename == "multi.png, multi.pdf, multi.svg" );
+    for(const auto& filename : { "multi.png", "multi.pdf", "multi.svg" })
+    {
+        CHECK( readfile(filename) == "rendered\n" );
+        std::remove(filename);
+    }
+
+    // A figure repeats its multiplot for each file, since replot only redraws the last plot of a multiplot
+    Figure figure = {{ plot, plot }};
+    CHECK( figure.save(std::vector<std::string>{ "multi.png", "multi.pdf" }) );
+    const auto figscript = scripts();
+    CHECK( count(figscript, "\nset multiplot") == 2 );
+    CHECK( count(figscript, "\nplot ") == 4 );
+    std::remove("multi.png");
+    std::remove("multi.pdf");
+
+    // Files restored from the render cache are not rendered again
+    plot.renderCache(std::make_shared<RenderCache>("sciplot-multi-cache"));
+    CHECK( plot.save({ "multi.png", "multi.pdf" }) );
+    scripts();
+    CHECK( plot.save({ "multi.png", "multi.pdf", "multi.svg" }) );
+    const auto missed = scripts();
+    CHECK( count(missed, "set terminal svg ") == 1 );
+    CHECK( count(missed, "set terminal png ") == 0 );
+    CHECK( count(missed, "set terminal pdf ") == 0 );
+    CHECK( plot.save({ "multi.png", "multi.svg" }) );
+    CHECK( scripts().empty() );
+    CHECK( reported.back().cached );
+
+    std::filesystem::remove_all("sciplot-multi-cache");
+    std::remove("multi.png");
+    std::remove("multi.pdf");
+    std::remove("multi.svg");
+}
+
+#endif
@@ -0,0 +1,161 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <cstdint>
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// sciplot includes
+#include <sciplot/Process.hpp>
+using namespace sciplot;
+
+#if !defined(_WIN32)
+
+TEST_CASE("Process", "[process]")
+{
+    SECTION("Pipes are connected to the standard streams of the child process")
+    {
+        internal::Process process;
+        REQUIRE( process.start({"cat"}, internal::PipeInput | internal::PipeOutput) );
+        CHECK( process.running() );
+
+        CHECK( process.write("first line\nsecond ") );
+        CHECK( process.write("line\nlast") );
+        process.closeinput();
+
+        std::string line;
+        CHECK( process.readline(internal::PipeOutput, line) );
+        CHECK( line == "first line" );
+        CHECK( process.readline(internal::PipeOutput, line) );
+        CHECK( line == "second line" );
+        CHECK( process.readline(internal::PipeOutput, line) );
+        CHECK( line == "last" );
+        CHECK_FALSE( process.readline(internal::PipeOutput, line) );
+
+        CHECK( process.wait() == 0 );
+        CHECK_FALSE( process.running() );
+    }
+
+    SECTION("The standard error and the exit code of the child process are available")
+    {
+        internal::Process process;
+        REQUIRE( process.start({"sh", "-c", "echo oops >&2; exit 3"}, internal::PipeError) );
+
+        std::string line;
+        CHECK( process.readline(internal::PipeError, line) );
+        CHECK( line == "oops" );
+        CHECK( process.wait() == 3 );
+    }
+
+    SECTION("Writing to a child process that has exited fails without raising SIGPIPE")
+    {
+        internal::Process process;
+        REQUIRE( process.start({"true"}, internal::PipeInput | internal::PipeOutput) );
+
+        std::string line;
+        CHECK_FALSE( process.readline(internal::PipeOutput, line) ); // wait for the child process to exit
+        CHECK_FALSE( process.write(std::string(1 << 20, 'x')) );
+    }
+
+    SECTION("Starting a missing program fails")
+    {
+        internal::Process process;
+        CHECK_FALSE( process.start({"sciplot-missing-program"}, internal::PipeInput) );
+        CHECK_FALSE( process.running() );
+        CHECK( process.wait() == -1 );
+    }
+
+    SECTION("A program run to completion returns its exit code and, if captured, its standard error")
+    {
+        auto result = internal::runprocess({"sh", "-c", "echo first >&2; echo second >&2; exit 2"}, true);
+        CHECK( result.started );
+        CHECK( result.status == 2 );
+        CHECK( result.error == "first\nsecond\n" );
+
+        result = internal::runprocess({"true"});
+        CHECK( result.started );
+        CHECK( result.status == 0 );
+        CHECK( result.error.empty() );
+
+        // Arguments are passed as they are, without any shell quoting
+        result = internal::runprocess({"sh", "-c", "test \"$0\" = 'a \"quoted\" $name'", "a \"quoted\" $name"});
+        CHECK( result.status == 0 );
+
+        result = internal::runprocess({"sciplot-missing-program"}, true);
+        CHECK_FALSE( result.started );
+        CHECK( result.status == -1 );
+    }
+
+    SECTION("A child process exceeding its deadline is killed")
+    {
+        internal::Process process;
+        REQUIRE( process.start({"sh", "-c", "echo started >&2; exec sleep 5"}, internal::PipeError) );
+        CHECK_FALSE( process.waituntil(internal::deadlineafter(0.2)) );
+        process.kill();
+
+        std::string line;
+        CHECK( process.readline(internal::PipeError, line) );
+        CHECK( line == "started" );
+        CHECK( process.wait() == -1 );
+
+        // A child process exiting before its deadline keeps its exit code
+        REQUIRE( process.start({"sh", "-c", "exit 4"}, 0) );
+        CHECK( process.waituntil(internal::deadlineafter(5.0)) );
+        CHECK( process.wait() == 4 );
+
+        // Reading a line fails once the deadline has passed
+        REQUIRE( process.start({"sleep", "5"}, internal::PipeOutput) );
+        CHECK_FALSE( process.readline(internal::PipeOutput, line, internal::deadlineafter(0.1)) );
+        process.kill();
+        CHECK( process.wait() == -1 );
+
+        RenderLimits limits;
+        limits.timeout = 0.2;
+        auto result = internal::runprocess({"sleep", "5"}, false, limits);
+        CHECK( result.started );
+        CHECK( result.timedout );
+        CHECK( result.status == -1 );
+
+        result = internal::runprocess({"true"}, true, limits);
+        CHECK_FALSE( result.timedout );
+        CHECK( result.status == 0 );
+    }
+
+#if defined(__linux__)
+    SECTION("Resource limits are applied to a child process")
+    {
+        RenderLimits limits;
+        limits.cputime = 5;
+        limits.memory = std::uint64_t(1) << 30;
+        const auto result = internal::runprocess({"sh", "-c", "sleep 0.2; test $(ulimit -t) -eq 5 && test $(ulimit -v) -eq 1048576"}, false, limits);
+        CHECK( result.status == 0 );
+        CHECK_FALSE( result.limitsfailed );
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,183 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// Test includes
+#include <tests/FakeGnuplot.hpp>
+#include <tests/Files.hpp>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+namespace fs = std::filesystem;
+
+TEST_CASE("RenderCache", "[cache]")
+{
+    const std::string directory = "sciplot-render-cache-test";
+    fs::remove_all(directory);
+
+    SECTION("Files are stored and restored by key")
+    {
+        RenderCache cache(directory);
+        CHECK( fs::is_directory(directory) );
+
+        writefile("rendered.svg", "<svg/>");
+        cache.store(1, "rendered.svg");
+        fs::remove("rendered.svg");
+
+        CHECK( cache.fetch(1, "restored.svg") );
+        CHECK( readfile("restored.svg") == "<svg/>" );
+        CHECK( fs::hard_link_count("restored.svg") == 1 );
+        CHECK_FALSE( cache.fetch(2, "missing.svg") );
+        CHECK_FALSE( cache.fetch(1, "restored.png") ); // the extension is part of the cached file name
+
+        cache.hardLinks();
+        CHECK( cache.fetch(1, "linked.svg") );
+        CHECK( fs::hard_link_count("linked.svg") == 2 );
+
+        // A cache miss leaves an existing file untouched, and a file restored as a hard link is unlinked before it is rendered again
+        CHECK_FALSE( cache.fetch(2, "linked.svg") );
+        CHECK( fs::exists("linked.svg") );
+        cache.detach("restored.svg");
+        CHECK( fs::exists("restored.svg") );
+        cache.detach("linked.svg");
+        CHECK_FALSE( fs::exists("linked.svg") );
+        CHECK( readfile(directory + "/0000000000000001.svg") == "<svg/>" );
+
+        fs::remove("restored.svg");
+    }
+
+    SECTION("The least recently used files are evicted when the size limit is exceeded")
+    {
+        RenderCache cache(directory, 10);
+
+        writefile("rendered.svg", "1234");
+        cache.store(1, "rendered.svg");
+        cache.store(2, "rendered.svg");
+
+        // Make the cached files older, with the second more recently used than the first
+        const auto now = fs::file_time_type::clock::now();
+        for(const auto& entry : fs::directory_iterator(directory))
+            fs::last_write_time(entry.path(), now - std::chrono::seconds(entry.path().stem() == "0000000000000001" ? 20 : 10));
+
+        CHECK( cache.fetch(1, "restored.svg") ); // the first is now the most recently used
+        cache.store(3, "rendered.svg");
+
+        CHECK( cache.fetch(1, "restored.svg") );
+        CHECK_FALSE( cache.fetch(2, "restored.svg") );
+        CHECK( cache.fetch(3, "restored.svg") );
+
+        fs::remove("rendered.svg");
+        fs::remove("restored.svg");
+    }
+
+#if !defined(_WIN32)
+    SECTION("Plots and figures are restored instead of rendered when their script and data are unchanged")
+    {
+        // A stand-in for gnuplot that writes the output files and counts the renders
+        FakeGnuplot fake(sessioncommands(
+            "    \"set output '\"*) output=${line#set output \\'}; output=${output%\\'}; echo rendered > \"$output\"; echo >> renders.log ;;\n"));
+        fs::remove("renders.log");
+        const auto numrenders = [] { auto log = readfile("renders.log"); return std::count(log.begin(), log.end(), '\n'); };
+
+        auto cache = std::make_shared<RenderCache>(directory);
+        GnuplotSession session(fake.program());
+
+        const std::vector<double> x = { 1, 2, 3 };
+        std::vector<double> y = { 4, 5, 6 };
+
+        Plot plot;
+        plot.renderCache(cache);
+        plot.drawCurve(x, y);
+        CHECK( plot.save("plot.svg", session) );
+        CHECK( plot.save("plot.svg", session) );
+        CHECK( numrenders() == 1 );
+
+        // A different plot object with the same script and data has the same key, despite its different temporary files
+        Plot same;
+        same.renderCache(cache);
+        same.drawCurve(x, y);
+        CHECK( same.renderKey() == plot.renderKey() );
+        CHECK( same.save("same.svg", session) );
+        CHECK( numrenders() == 1 );
+        CHECK( readfile("same.svg") == "rendered\n" );
+
+        // Changes of data, terminal or script are cache misses
+        y[1] = 7;
+        Plot changed;
+        changed.renderCache(cache);
+        changed.drawCurve(x, y);
+        CHECK( changed.renderKey() != plot.renderKey() );
+        CHECK( changed.save("changed.svg", session) );
+        CHECK( plot.save("plot.png", session) );
+        plot.xlabel("x");
+        CHECK( plot.save("plot.svg", session) );
+        CHECK( numrenders() == 4 );
+
+        Figure figure = {{ plot, same }};
+        figure.renderCache(cache);
+        CHECK( figure.save("figure.svg", session) );
+        CHECK( figure.save("figure.svg", session) );
+        CHECK( numrenders() == 5 );
+
+        Figure transposed = {{ plot }, { same }};
+        transposed.renderCache(cache);
+        CHECK( transposed.save("figure.svg", session) );
+        CHECK( numrenders() == 6 );
+
+        for(auto file : { "plot.svg", "plot.png", "same.svg", "changed.svg", "figure.svg", "renders.log" })
+            fs::remove(file);
+    }
+
+    SECTION("A cache miss keeps the previous file if the render fails")
+    {
+        // A stand-in for gnuplot that writes the output files, replaced below by one that fails
+        FakeGnuplot fake(writeoutputs("rendered"));
+
+        Plot plot;
+        plot.renderCache(std::make_shared<RenderCache>(directory));
+        plot.drawCurve(std::vector<double>{ 1, 2, 3 }, std::vector<double>{ 4, 5, 6 });
+        CHECK( plot.save("plot.svg") );
+        CHECK( readfile("plot.svg") == "rendered\n" );
+
+        fake.write("exit 1\n");
+        plot.xlabel("x");
+        CHECK_FALSE( plot.save("plot.svg") );
+        CHECK( readfile("plot.svg") == "rendered\n" );
+
+        fs::remove("plot.svg");
+    }
+#endif
+
+    fs::remove_all(directory);
+}
@@ -0,0 +1,97 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <filesystem>
+#include <vector>
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// Test includes
+#include <tests/FakeGnuplot.hpp>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+#if !defined(_WIN32)
+
+TEST_CASE("RenderLimits", "[limits]")
+{
+    // A stand-in for gnuplot, found first in PATH, that writes part of the output file of the script and hangs
+    FakeGnuplot fake(writeoutputs("partial") + "exec sleep 5\n");
+
+    std::vector<RenderStats> reported;
+    auto callback = [&](const RenderStats& stats) { reported.push_back(stats); };
+
+    RenderLimits limits;
+    limits.timeout = 0.2;
+
+    Plot plot;
+    plot.drawCurve(std::vector<double>{ 1, 2, 3 }, std::vector<double>{ 4, 5, 6 });
+    plot.renderCallback(callback);
+    plot.renderLimits(limits);
+
+    // A render exceeding its timeout is reported distinctly, without leaving any file behind
+    const auto script = plot.repr();
+    const auto begin = script.find("'plot") + 1;
+    const auto datafile = script.substr(begin, script.find('\'', begin) - begin);
+    CHECK_THROWS_AS( plot.save("plot.pdf"), RenderTimeout );
+    REQUIRE( reported.size() == 1 );
+    CHECK( reported[0].timedout );
+    CHECK_FALSE( reported[0].success );
+    CHECK( reported[0].gnuplottime < 5.0 );
+    CHECK_FALSE( std::filesystem::exists("plot.pdf") );
+    CHECK_FALSE( std::filesystem::exists(datafile) );
+
+    try { plot.save("plot.pdf"); }
+    catch(const RenderTimeout& error) { CHECK( error.filename() == "plot.pdf" ); }
+
+    // Figures are killed likewise
+    Figure figure = {{ plot }};
+    figure.renderLimits(limits);
+    CHECK_THROWS_AS( figure.save("figure.pdf"), RenderTimeout );
+    CHECK_FALSE( std::filesystem::exists("figure.pdf") );
+
+    // Renders within their timeout are not affected
+    fake.write("exit 0\n");
+    limits.timeout = 5.0;
+    plot.renderLimits(limits);
+    CHECK( plot.save("plot.pdf") );
+    CHECK_FALSE( reported.back().timedout );
+    CHECK_FALSE( reported.back().limitsfailed );
+
+    // Resource limits that could not be applied are reported, here because sessions only apply the timeout
+    limits.cputime = 5;
+    plot.renderLimits(limits);
+    FakeGnuplot sessionfake(sessioncommands());
+    GnuplotSession session(sessionfake.program());
+    CHECK( plot.save("plot.pdf", session) );
+    CHECK( reported.back().limitsfailed );
+    session.close();
+}
+
+#endif
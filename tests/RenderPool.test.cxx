@@ -0,0 +1,128 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <vector>
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// Test includes
+#include <tests/FakeGnuplot.hpp>
+#include <tests/Files.hpp>
+
+// sciplot includes
+#include <sciplot/RenderPool.hpp>
+using namespace sciplot;
+
+#if !defined(_WIN32)
+
+TEST_CASE("RenderPool", "[pool]")
+{
+    // A stand-in for gnuplot that acknowledges print commands like gnuplot does and exits on errors
+    FakeGnuplot fake(sessioncommands("    *sciplot-test-error*) exit 1 ;;\n"));
+    const auto program = fake.program();
+
+    SECTION("Jobs are distributed across the workers and report their results")
+    {
+        RenderPool pool(3, 1, program);
+        CHECK( pool.numWorkers() == 3 );
+
+        std::vector<Plot> plots(10);
+        for(auto& plot : plots)
+            plot.drawCurve(std::vector<double>{ 1, 2, 3 }, std::vector<double>{ 4, 5, 6 });
+        plots[4].gnuplot("sciplot-test-error");
+
+        std::vector<std::future<bool>> results;
+        for(std::size_t i = 0; i < plots.size(); ++i)
+            results.push_back(pool.save(plots[i], "plot" + internal::str(i) + ".pdf"));
+
+        for(std::size_t i = 0; i < results.size(); ++i)
+            CHECK( results[i].get() == (i != 4) );
+
+        Figure figure = {{ plots[0], plots[1] }};
+        CHECK( pool.save(figure, "figure.pdf").get() );
+    }
+
+    SECTION("Pending jobs are rendered before the pool is destroyed")
+    {
+        std::vector<std::future<bool>> results;
+        {
+            RenderPool pool(2, 0, program);
+            std::vector<Plot> plots(6);
+            for(auto& plot : plots)
+                results.push_back(pool.save(plot, "plot.pdf"));
+        }
+        for(auto& result : results)
+            CHECK( result.wait_for(std::chrono::seconds(0)) == std::future_status::ready );
+    }
+
+    SECTION("All jobs fail without a gnuplot executable")
+    {
+        RenderPool pool(2, 0, "sciplot-missing-gnuplot");
+        CHECK_FALSE( pool.save(Plot(), "plot.pdf").get() );
+    }
+}
+
+TEST_CASE("RenderPool::save with the same plot", "[pool]")
+{
+    // A stand-in for gnuplot that copies the data file of the plot to the output file, slowly enough for renders to overlap
+    FakeGnuplot fake(sessioncommands("    \"set output '\"*) output=${line#*\\'}; output=${output%\\'} ;;\n"
+                                     "    \"    '\"*) data=${line#*\\'}; data=${data%%\\'*}; sleep 0.3; cp \"$data\" \"$output\" ;;\n"));
+
+    std::vector<std::future<bool>> results;
+    {
+        RenderPool pool(2, 0, fake.program());
+
+        // The plot is queued twice with different data, each copy rendering from data files of its own
+        Plot plot;
+        plot.drawCurve(std::vector<double>{ 1, 2, 3 }, std::vector<double>{ 4, 5, 6 });
+        results.push_back(pool.save(plot, "first.txt"));
+        plot.clear();
+        plot.drawCurve(std::vector<double>{ 1, 2, 3 }, std::vector<double>{ 7, 8, 9 });
+        results.push_back(pool.save(plot, "second.txt"));
+
+        Figure figure = {{ plot }};
+        results.push_back(pool.save(figure, "third.txt"));
+        results.push_back(pool.save(figure, "fourth.txt"));
+    }
+    for(auto& result : results)
+        CHECK( result.get() );
+
+    CHECK( readfile("first.txt").find("4") != std::string::npos );
+    CHECK( readfile("first.txt").find("7") == std::string::npos );
+    CHECK( readfile("second.txt").find("7") != std::string::npos );
+    CHECK( readfile("second.txt").find("4") == std::string::npos );
+    CHECK( readfile("third.txt") == readfile("second.txt") );
+    CHECK( readfile("fourth.txt") == readfile("second.txt") );
+
+    for(const auto& filename : { "first.txt", "second.txt", "third.txt", "fourth.txt" })
+        std::remove(filename);
+}
+
+#endif
@@ -0,0 +1,138 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// Test includes
+#include <tests/FakeGnuplot.hpp>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+#if !defined(_WIN32)
+
+TEST_CASE("RenderStats", "[stats]")
+{
+    // A stand-in for gnuplot, found first in PATH, that writes the output file of the script
+    FakeGnuplot fake(writeoutputs("rendered"));
+
+    std::vector<RenderStats> reported;
+    auto callback = [&](const RenderStats& stats) { reported.push_back(stats); };
+
+    Plot plot;
+    plot.drawCurve(std::vector<double>{ 1, 2, 3 }, std::vector<double>{ 4, 5, 6 });
+    plot.renderCallback(callback);
+
+    // Saving the data reports the number of bytes written to the data files
+    plot.autoclean(false);
+    plot.savePlotData();
+    REQUIRE( reported.size() == 1 );
+    CHECK( reported[0].operation == "saveplotdata" );
+    CHECK( reported[0].success );
+    const auto script = plot.repr();
+    const auto begin = script.find("'plot") + 1;
+    const auto datafile = script.substr(begin, script.find('\'', begin) - begin);
+    CHECK( reported[0].databytes == std::filesystem::file_size(datafile) );
+    plot.cleanup();
+
+    // Saving the plot reports each phase
+    plot.autoclean(true);
+    CHECK( plot.save("plot.pdf") );
+    REQUIRE( reported.size() == 2 );
+    const auto& stats = reported[1];
+    CHECK( stats.operation == "save" );
+    CHECK( stats.filename == "plot.pdf" );
+    CHECK( stats.success );
+    CHECK_FALSE( stats.cached );
+    CHECK_FALSE( stats.gnuplotmissing );
+    CHECK( stats.scriptbytes > 0 );
+    CHECK( stats.databytes == reported[0].databytes );
+    CHECK( stats.gnuplottime > 0.0 );
+    CHECK( stats.totaltime >= stats.cachetime + stats.scripttime + stats.datatime + stats.gnuplottime + stats.cleanuptime );
+
+    // Restoring the plot from the render cache is reported as such, without any data written
+    const std::string directory = "sciplot-stats-cache";
+    std::filesystem::remove_all(directory);
+    plot.renderCache(std::make_shared<RenderCache>(directory));
+    CHECK( plot.save("plot.pdf") );
+    CHECK( plot.save("plot.pdf") );
+    REQUIRE( reported.size() == 4 );
+    CHECK_FALSE( reported[2].cached );
+    CHECK( reported[3].cached );
+    CHECK( reported[3].success );
+    CHECK( reported[3].databytes == 0 );
+
+    // Figures report their own stats, including the data of all plots
+    Plot other;
+    other.drawPoints(std::vector<double>{ 1, 2 }, std::vector<double>{ 3, 4 });
+    Figure figure = {{ plot, other }};
+    figure.renderCallback(callback);
+    CHECK( figure.save("figure.pdf") );
+    REQUIRE( reported.size() == 5 );
+    CHECK( reported[4].operation == "save" );
+    CHECK( reported[4].databytes > stats.databytes );
+    CHECK( reported[4].scriptbytes > stats.scriptbytes );
+
+    std::filesystem::remove_all(directory);
+    std::remove("plot.pdf");
+    std::remove("figure.pdf");
+}
+
+TEST_CASE("RenderStats::gnuplotmissing", "[stats]")
+{
+    // A PATH without any gnuplot, restored when the fake is destroyed
+    FakeGnuplot fake("");
+    std::remove(fake.program().c_str());
+    setenv("PATH", fake.directory().c_str(), 1);
+
+    std::vector<RenderStats> reported;
+
+    Plot plot;
+    plot.drawCurve(std::vector<double>{ 1, 2, 3 }, std::vector<double>{ 4, 5, 6 });
+    plot.renderCallback([&](const RenderStats& stats) { reported.push_back(stats); });
+
+    // The failure to start gnuplot is reported in the stats, instead of being printed
+    CHECK_FALSE( plot.save("missing.pdf") );
+    REQUIRE( reported.size() == 1 );
+    CHECK_FALSE( reported[0].success );
+    CHECK( reported[0].gnuplotmissing );
+
+    GnuplotSession session;
+    CHECK_FALSE( plot.save("missing.pdf", session) );
+    REQUIRE( reported.size() == 2 );
+    CHECK( reported[1].gnuplotmissing );
+    CHECK_FALSE( session.started() );
+}
+
+#endif
@@ -0,0 +1,108 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// sciplot includes
+#include <sciplot/RenderSteps.hpp>
+using namespace sciplot;
+
+TEST_CASE("internal::render", "[render]")
+{
+    std::vector<std::string> calls;
+    std::vector<RenderStats> reported;
+    std::vector<std::string> scripted;
+    auto status = 0;
+    auto timedout = false;
+
+    // Steps that record their calls and write the files given to the script as gnuplot would
+    internal::RenderSteps steps;
+    steps.operation = "save";
+    steps.filenames = { "steps.png", "steps.pdf" };
+    steps.preparedata = [&] { calls.push_back("preparedata"); };
+    steps.writescript = [&](const std::vector<std::string>& pending) { calls.push_back("writescript"); scripted = pending; return std::size_t(10); };
+    steps.writedata = [&] { calls.push_back("writedata"); return std::size_t(20); };
+    steps.rungnuplot = [&] {
+        calls.push_back("rungnuplot");
+        for(const auto& filename : scripted)
+            std::ofstream(filename) << "rendered";
+        internal::ProcessResult result;
+        result.started = true;
+        result.status = status;
+        result.timedout = timedout;
+        return result;
+    };
+    steps.cleanup = [&] { calls.push_back("cleanup"); };
+    steps.callback = [&](const RenderStats& stats) { reported.push_back(stats); };
+
+    // The steps are run in order, and their stats are reported
+    CHECK( internal::render(steps) );
+    CHECK( calls == std::vector<std::string>{ "preparedata", "writescript", "writedata", "rungnuplot", "cleanup" } );
+    CHECK( scripted == steps.filenames );
+    REQUIRE( reported.size() == 1 );
+    CHECK( reported[0].operation == "save" );
+    CHECK( reported[0].filename == "steps.png, steps.pdf" );
+    CHECK( reported[0].success );
+    CHECK( reported[0].scriptbytes == 10 );
+    CHECK( reported[0].databytes == 20 );
+
+    // Only the files missing from the render cache are rendered, and nothing is run if none is missing
+    RenderCache cache("sciplot-steps-cache");
+    steps.cache = &cache;
+    steps.cachekey = [](const std::string& filename) { return std::uint64_t(filename.size()); };
+    steps.filenames = { "steps.png" };
+    CHECK( internal::render(steps) );
+    CHECK_FALSE( reported.back().cached );
+    steps.filenames = { "steps.png", "steps.svg" };
+    CHECK( internal::render(steps) );
+    CHECK( scripted == std::vector<std::string>{ "steps.svg" } );
+    calls.clear();
+    CHECK( internal::render(steps) );
+    CHECK( calls.empty() );
+    CHECK( reported.back().cached );
+    steps.cache = nullptr;
+
+    // A failed render is not stored in the cache, and a timed out one removes its partial outputs before throwing
+    status = 1;
+    CHECK_FALSE( internal::render(steps) );
+    CHECK_FALSE( reported.back().success );
+    timedout = true;
+    CHECK_THROWS_AS( internal::render(steps), RenderTimeout );
+    CHECK( reported.back().timedout );
+    CHECK_FALSE( std::filesystem::exists("steps.png") );
+    CHECK_FALSE( std::filesystem::exists("steps.svg") );
+
+    std::filesystem::remove_all("sciplot-steps-cache");
+    std::remove("steps.pdf");
+}
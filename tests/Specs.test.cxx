@@ -0,0 +1,74 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// sciplot includes
+#include <sciplot/specs/DrawSpecs.hpp>
+#include <sciplot/specs/GridSpecs.hpp>
+#include <sciplot/specs/LineSpecsOf.hpp>
+using namespace sciplot;
+
+TEST_CASE("Specs", "[specs]")
+{
+    // The string representation is cached until a setter is called
+    LineSpecs line;
+    line.lineWidth(2);
+    const auto& cached = line.cachedRepr();
+    CHECK( cached == line.repr() );
+    CHECK( line.cached() );
+    CHECK( &line.cachedRepr() == &cached );
+
+    line.lineColor("red");
+    CHECK_FALSE( line.cached() );
+    CHECK( line.cachedRepr() == line.repr() );
+    CHECK( line.cachedRepr().find("linecolor 'red'") != std::string::npos );
+
+    // Setters of every base class of a specs class mark it as changed
+    DrawSpecs draw("'file.dat'", "1:2", "lines");
+    CHECK( std::string(draw) == "'file.dat' using 1:2 with lines linewidth 2" );
+    draw.lineWidth(3).fillSolid().label("data");
+    CHECK( std::string(draw) == draw.repr() );
+    draw.use("2:1");
+    CHECK( std::string(draw) == draw.repr() );
+
+    // Copies keep the cached representation, but are changed independently
+    DrawSpecs copy = draw;
+    CHECK( copy.cached() );
+    copy.lineWidth(4);
+    CHECK( std::string(copy) != std::string(draw) );
+    CHECK( std::string(draw) == draw.repr() );
+
+    // Grid lines along tics returned by reference and changed afterwards are taken into account
+    GridSpecs grid;
+    grid.show();
+    auto& xtics = grid.xtics();
+    const auto before = std::string(grid);
+    xtics.lineColor("blue");
+    CHECK_FALSE( grid.cached() );
+    CHECK( std::string(grid) != before );
+    CHECK( std::string(grid) == grid.repr() );
+}
@@ -0,0 +1,83 @@
+// sciplot - a modern C++ scientific plotting library powered by gnuplot
+// https://github.com/sciplot/sciplot
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+//
+// Copyright (c) 2018-2021 Allan Leal
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// C++ includes
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+// Catch includes
+#include <tests/catch.hpp>
+
+// Test includes
+#include <tests/Files.hpp>
+
+// sciplot includes
+#include <sciplot/sciplot.hpp>
+using namespace sciplot;
+
+TEST_CASE("Tracer", "[tracer]")
+{
+    const std::string filename = "sciplot-trace.json";
+
+    // Nothing is recorded while tracing is disabled
+    Plot untraced;
+    untraced.drawCurve(std::vector<double>{ 1, 2 }, std::vector<double>{ 3, 4 });
+    CHECK( saveTrace(filename) );
+    CHECK( readfile(filename) == "{\"traceEvents\":[\n],\"displayTimeUnit\":\"ms\"}\n" );
+
+    // Traced operations are recorded with the thread that ran them
+    enableTracing();
+    Plot plot;
+    plot.drawCurve(std::vector<double>{ 1, 2 }, std::vector<double>{ 3, 4 });
+    plot.savePlotData();
+    plot.cleanup();
+    std::thread([&] { plot.repr(); }).join();
+    enableTracing(false);
+    untraced.repr();
+
+    CHECK( saveTrace(filename) );
+    const auto trace = readfile(filename);
+    CHECK( trace.find("{\"name\":\"Plot::drawWithVecs\",\"cat\":\"sciplot\",\"ph\":\"X\",\"ts\":") != std::string::npos );
+    CHECK( trace.find("\"name\":\"Plot::savePlotData\"") != std::string::npos );
+    CHECK( trace.find("\"name\":\"Plot::cleanup\"") != std::string::npos );
+
+    const auto repr = trace.find("\"name\":\"Plot::repr\"");
+    REQUIRE( repr != std::string::npos );
+    CHECK( trace.find("\"name\":\"Plot::repr\"", repr + 1) == std::string::npos ); // the untraced call is not recorded
+
+    auto threadof = [&](const std::string& name) {
+        const auto begin = trace.find("\"tid\":", trace.find("\"name\":\"" + name + "\"")) + 6;
+        return trace.substr(begin, trace.find('}', begin) - begin);
+    };
+    CHECK( threadof("Plot::repr") != threadof("Plot::drawWithVecs") );
+    CHECK( threadof("Plot::cleanup") == threadof("Plot::drawWithVecs") );
+
+    // The recorded events are discarded once saved
+    CHECK( saveTrace(filename) );
+    CHECK( readfile(filename).find("\"name\"") == std::string::npos );
+
+    std::remove(filename.c_str());
+}
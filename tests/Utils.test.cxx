@@ -23,11 +23,21 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <clocale>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
 // Catch includes
 #include <tests/catch.hpp>
 
 // sciplot includes
 #include <sciplot/Utils.hpp>
+#include <sciplot/Vec.hpp>
 using namespace sciplot;
 
 TEST_CASE("plotting tests", "[plot]")
@@ -42,3 +52,188 @@ TEST_CASE("plotting tests", "[plot]")
     CHECK(gnuplot::cleanpath("build:*?!\"<>|/xy.svg") == "build/xy.svg");
     CHECK(gnuplot::cleanpath("build:*?!\"<>|/xy:*?!\"<>|.svg") == "build/xy.svg");
 }
+
+TEST_CASE("binary data set tests", "[plot]")
+{
+    const std::vector<double> x = { 1.0, 2.0, 3.0 };
+    const std::vector<float> y = { 4.0f, 5.0f, 6.0f };
+
+    std::ostringstream out;
+    gnuplot::writebinarydataset(out, x, y);
+
+    const auto bytes = out.str();
+    CHECK(bytes.size() == 3 * (sizeof(double) + sizeof(float)));
+
+    double x1 = 0.0;
+    float y1 = 0.0f;
+    std::memcpy(&x1, bytes.data() + sizeof(double) + sizeof(float), sizeof(double));
+    std::memcpy(&y1, bytes.data() + 2 * sizeof(double) + sizeof(float), sizeof(float));
+    if(internal::islittleendian())
+    {
+        CHECK(x1 == 2.0);
+        CHECK(y1 == 5.0f);
+    }
+
+    CHECK((internal::binaryformat<decltype(x)>() + internal::binaryformat<decltype(y)>()) == "%double%float");
+    CHECK(gnuplot::binarydatasetstr("plot0.bin", 48, 3, "%double%float") == "'plot0.bin' binary record=3 format=\"%double%float\" endian=little skip=48");
+}
+
+TEST_CASE("number formatting tests", "[plot]")
+{
+    CHECK(internal::str(2.0) == "2");
+    CHECK(internal::str(0.1) == "0.1");
+    CHECK(internal::str(0.1 + 0.2) == "0.30000000000000004");
+    CHECK(internal::str(1.5f) == "1.5");
+    CHECK(internal::str(-42) == "-42");
+    CHECK(internal::str(std::size_t(7)) == "7");
+    CHECK(internal::str('a') == "a");
+    CHECK(internal::str(true) == "1");
+
+    const std::vector<double> x = { 0.5, 1.0 / 3.0, -2e-300 };
+    const std::vector<int> y = { 1, 2, 3 };
+    const Strings z = { "A", "B", "C" };
+
+    std::ostringstream out;
+    internal::write(out, z, x, y);
+    CHECK(out.str() == "\"A\" 0.5 1\n\"B\" 0.3333333333333333 2\n\"C\" -2e-300 3\n");
+
+    // Ensure every formatted number reads back to the same value
+    for(auto val : { 1.0 / 3.0, 1e+300, 123456.789, 5e-324, -0.0 })
+        CHECK(std::strtod(internal::str(val).c_str(), nullptr) == val);
+
+    // The snprintf fallback of standard libraries without floating point std::to_chars gives the same results
+    auto printed = [](auto val) {
+        char chars[internal::MAX_NUMBER_CHARS];
+        return std::string(chars, internal::printfchars(chars, chars + internal::MAX_NUMBER_CHARS, val));
+    };
+    CHECK(printed(2.0) == "2");
+    CHECK(printed(0.1 + 0.2) == "0.30000000000000004");
+    CHECK(printed(1.5f) == "1.5");
+
+    // Numbers are written with a decimal point in locales with a decimal comma
+    const std::string previous = std::setlocale(LC_NUMERIC, nullptr);
+    for(auto name : { "de_DE.UTF-8", "de_DE.utf8", "de_DE" })
+    {
+        if(!std::setlocale(LC_NUMERIC, name))
+            continue;
+        CHECK(printed(1.5) == "1.5");
+        CHECK(printed(0.1 + 0.2) == "0.30000000000000004");
+        CHECK(internal::str(1.5) == "1.5");
+        break;
+    }
+    std::setlocale(LC_NUMERIC, previous.c_str());
+}
+
+/// A stream buffer that counts the bytes and records the largest chunk written to it.
+struct ChunkCountingBuffer : std::streambuf
+{
+    std::size_t numbytes = 0;
+    std::size_t maxchunk = 0;
+
+    auto xsputn(const char*, std::streamsize n) -> std::streamsize override
+    {
+        numbytes += n;
+        maxchunk = std::max<std::size_t>(maxchunk, n);
+        return n;
+    }
+
+    auto overflow(int ch) -> int override
+    {
+        numbytes += 1;
+        return ch;
+    }
+};
+
+TEST_CASE("streaming data set tests", "[plot]")
+{
+    const Vec x = linspace(0.0, 1.0, 200000);
+    const std::vector<float> y(x.size(), 0.25f);
+
+    ChunkCountingBuffer textbuffer;
+    std::ostream textout(&textbuffer);
+    internal::write(textout, x, y);
+
+    std::ostringstream text;
+    for(std::size_t i = 0; i < x.size(); ++i)
+        internal::writeline(text, i, x, y);
+
+    CHECK(textbuffer.numbytes == text.str().size());
+    CHECK(textbuffer.maxchunk < internal::DEFAULT_DATA_BUFFER_SIZE + 2 * internal::MAX_NUMBER_CHARS);
+
+    ChunkCountingBuffer binarybuffer;
+    std::ostream binaryout(&binarybuffer);
+    internal::writebinary(binaryout, x, y);
+
+    CHECK(binarybuffer.numbytes == x.size() * (sizeof(double) + sizeof(float)));
+    CHECK(binarybuffer.maxchunk < internal::DEFAULT_DATA_BUFFER_SIZE + sizeof(double) + sizeof(float));
+}
+
+TEST_CASE("scratch file naming tests", "[plot]")
+{
+    const auto pid = internal::str(internal::processid());
+
+    CHECK(scratchDirectory() == "");
+    CHECK(internal::scratchfilename("plot", 3, ".dat") == "plot" + pid + "-3.dat");
+
+    scratchDirectory("/dev/shm");
+    CHECK(scratchDirectory() == "/dev/shm");
+    CHECK(internal::scratchfilename("show", 0, ".plt") == "/dev/shm/show" + pid + "-0.plt");
+
+    scratchDirectory("/tmp/");
+    CHECK(internal::scratchfilename("multishow", 12, ".plt") == "/tmp/multishow" + pid + "-12.plt");
+
+    scratchDirectory("");
+}
+
+TEST_CASE("parallel for tests", "[plot]")
+{
+    std::vector<std::size_t> squares(1000);
+    internal::parallelfor(squares.size(), internal::PARALLEL_MIN_WORK, [&](std::size_t i) { squares[i] = i * i; });
+    for(std::size_t i = 0; i < squares.size(); ++i)
+        CHECK(squares[i] == i * i);
+
+    // Calls with too little work, or in a thread limited to a single thread, are all made by the calling thread
+    auto threads = [](std::size_t work) {
+        std::vector<std::thread::id> ids(100);
+        internal::parallelfor(ids.size(), work, [&](std::size_t i) { ids[i] = std::this_thread::get_id(); });
+        return ids;
+    };
+    const auto caller = std::vector<std::thread::id>(100, std::this_thread::get_id());
+    CHECK(threads(internal::PARALLEL_MIN_WORK - 1) == caller);
+    internal::parallelmaxthreads = 1;
+    CHECK(internal::parallelthreads() == 1);
+    CHECK(threads(internal::PARALLEL_MIN_WORK) == caller);
+    internal::parallelmaxthreads = 0;
+    CHECK(internal::parallelthreads() == std::max<std::size_t>(std::thread::hardware_concurrency(), 1));
+
+    // Exceptions thrown by the calls are rethrown once all calls have completed
+    std::atomic<std::size_t> numcalls{0};
+    CHECK_THROWS_AS(internal::parallelfor(100, internal::PARALLEL_MIN_WORK, [&](std::size_t i) {
+        ++numcalls;
+        if(i == 42) throw std::runtime_error("error");
+    }), std::runtime_error);
+    CHECK(numcalls == 100);
+}
+
+TEST_CASE("script builder tests", "[plot]")
+{
+    internal::ScriptBuilder script(64);
+    script << "set xrange " << '[' << 0 << ':' << 2.5 << ']' << '\n';
+    script.command("set yrange", "[0:1]");
+    script.command("set samples", "");
+    script << std::string("plot ");
+    script.option("using", "1:2").option("with", "");
+    CHECK(script.view() == "set xrange [0:2.5]\nset yrange [0:1]\nplot using 1:2 ");
+
+    internal::ScriptBuilderBuffer buffer(script);
+    std::ostream out(&buffer);
+    out << "with lines" << 'x';
+    CHECK(script.view() == "set xrange [0:2.5]\nset yrange [0:1]\nplot using 1:2 with linesx");
+
+    // Compacting trims and collapses spaces like removeExtraWhitespaces
+    internal::ScriptBuilder options;
+    options << "  linewidth 2    dashtype 3  ";
+    CHECK(options.compact().view() == internal::removeExtraWhitespaces("  linewidth 2    dashtype 3  "));
+    CHECK(options.release() == "linewidth 2 dashtype 3");
+    CHECK(options.size() == 0);
+}